@@ -0,0 +1,112 @@
+// Scrolls VaultView through a 5,000-asset wallet and reports frame times:
+//
+//   flutter test benchmark/asset_grid_scroll_benchmark.dart
+//
+// Each frame jumps the scroll view by a third of the viewport and pumps
+// once. The time is the build, layout and paint work of that frame on the
+// test binding; rasterization is not included. The pass is repeated with one
+// asset repriced per frame, as a live price stream would do. Reported: p50,
+// p90, p99 and worst frame, and how many asset cards stay mounted.
+
+// ignore_for_file: avoid_print
+import 'dart:math' as math;
+
+import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
+import 'package:crypto_treasury/ui/featuers/vault/views/vault_view.dart';
+import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_asset_card.dart';
+
+import '../test/support/wallet_doubles.dart';
+
+const int assetCount = 5000;
+const int frames = 600;
+
+CryptoWallet wallet() => CryptoWallet(
+  address: '0x00000000000000000000000000000000000000aa',
+  chainId: 1,
+  assets: List.unmodifiable([
+    for (var i = 0; i < assetCount; i++)
+      CryptoAsset(
+        symbol: 'TKN$i',
+        name: 'Token $i',
+        amount: FixedDecimal.fromInt(1000 + i % 97),
+        logoUrl: null,
+        usdValue: FixedDecimal.fromInt(5000 + i % 1013),
+      ),
+  ]),
+);
+
+String percentiles(List<int> micros) {
+  final sorted = List.of(micros)..sort();
+  String at(double p) =>
+      (sorted[((sorted.length - 1) * p).round()] / 1000).toStringAsFixed(2);
+  return 'p50 ${at(0.5)} ms, p90 ${at(0.9)} ms, p99 ${at(0.99)} ms, '
+      'max ${at(1)} ms';
+}
+
+void main() {
+  testWidgets('scroll $assetCount assets', (tester) async {
+    tester.view.physicalSize = const Size(1280, 900);
+    tester.view.devicePixelRatio = 1;
+    addTearDown(tester.view.reset);
+
+    final viewModel = ScriptedViewModel();
+    viewModel.current = viewModel.current.copyWith(wallet: wallet());
+    await tester.pumpWidget(
+      ProviderScope(
+        overrides: [walletViewModelProvider.overrideWith((ref) => viewModel)],
+        child: const MaterialApp(home: VaultView()),
+      ),
+    );
+    await tester.pumpAndSettle();
+
+    final position = tester
+        .state<ScrollableState>(
+          find
+              .descendant(
+                of: find.byType(CustomScrollView),
+                matching: find.byType(Scrollable),
+              )
+              .first,
+        )
+        .position;
+
+    Future<List<int>> scroll({required bool reprice}) async {
+      final times = <int>[];
+      final step = position.viewportDimension / 3;
+      position.jumpTo(0);
+      await tester.pump();
+      for (var frame = 0; frame < frames; frame++) {
+        if (reprice) {
+          final current = viewModel.current.wallet!;
+          final symbol = 'TKN${(frame * 7) % assetCount}';
+          viewModel.current = viewModel.current.copyWith(
+            wallet: current.repriced({symbol: 1.0 + frame}),
+          );
+        }
+        position.jumpTo(
+          math.min(position.pixels + step, position.maxScrollExtent),
+        );
+        final watch = Stopwatch()..start();
+        await tester.pump();
+        times.add(watch.elapsedMicroseconds);
+      }
+      return times;
+    }
+
+    final scrolled = await scroll(reprice: false);
+    print('scroll: ${percentiles(scrolled)}');
+    print(
+      '  cells mounted at the end: '
+      '${find.byType(VaultAssetCard).evaluate().length} of $assetCount',
+    );
+    final repriced = await scroll(reprice: true);
+    print('scroll + price tick: ${percentiles(repriced)}');
+  });
+}
@@ -0,0 +1,87 @@
+// Compares per-read balance normalization over 10k assets:
+//
+//   dart run benchmark/balance_normalization_benchmark.dart
+//
+// `legacy` is the previous BigInt.pow + double division on every read;
+// `fixed` reads CryptoAsset.normalizedBalance, cached by FixedDecimal after the
+// first pass. `valuation` is the one-off exact USD valuation per asset.
+
+// ignore_for_file: avoid_print
+import 'dart:math';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+
+const int assetCount = 10000;
+const int passes = 20;
+
+double legacyNormalize(BigInt value, int decimals) {
+  if (decimals <= 0) {
+    return value.toDouble();
+  }
+  final divisor = BigInt.from(10).pow(decimals);
+  return value.toDouble() / divisor.toDouble();
+}
+
+void main() {
+  final random = Random(7);
+  const decimalChoices = [6, 8, 9, 18];
+  final raw = List.generate(assetCount, (index) {
+    final decimals = decimalChoices[index % decimalChoices.length];
+    // Up to ~10^9 whole tokens with a full fractional part.
+    final whole = BigInt.from(random.nextInt(1 << 30));
+    final fraction = BigInt.from(random.nextInt(1 << 30));
+    return (whole * BigInt.from(10).pow(decimals) + fraction, decimals);
+  });
+
+  final valuation = Stopwatch()..start();
+  final assets = <CryptoAsset>[];
+  for (final (balance, decimals) in raw) {
+    final amount = FixedDecimal(balance, decimals);
+    assets.add(
+      CryptoAsset(
+        symbol: 'T$decimals',
+        name: 'Token',
+        amount: amount,
+        logoUrl: null,
+        usdValue: CryptoAsset.valueAt(amount, 0.5 + random.nextDouble()),
+      ),
+    );
+  }
+  valuation.stop();
+
+  var sink = 0.0;
+  final legacy = Stopwatch()..start();
+  for (var pass = 0; pass < passes; pass++) {
+    for (final (balance, decimals) in raw) {
+      sink += legacyNormalize(balance, decimals);
+    }
+  }
+  legacy.stop();
+
+  final fixed = Stopwatch()..start();
+  for (var pass = 0; pass < passes; pass++) {
+    for (final asset in assets) {
+      sink += asset.normalizedBalance;
+    }
+  }
+  fixed.stop();
+
+  var maxRelativeError = 0.0;
+  for (var i = 0; i < assetCount; i++) {
+    final (balance, decimals) = raw[i];
+    final expected = legacyNormalize(balance, decimals);
+    final error = (assets[i].normalizedBalance - expected).abs() / expected;
+    maxRelativeError = max(maxRelativeError, error);
+  }
+
+  String perRead(Stopwatch watch) =>
+      '${(watch.elapsedMicroseconds * 1000 / (assetCount * passes)).toStringAsFixed(1)} ns/read';
+
+  print('[balance_normalization] $assetCount assets x $passes passes');
+  print('  legacy    ${legacy.elapsedMilliseconds} ms (${perRead(legacy)})');
+  print('  fixed     ${fixed.elapsedMilliseconds} ms (${perRead(fixed)})');
+  print('  valuation ${valuation.elapsedMilliseconds} ms for $assetCount assets');
+  print('  max relative difference ${maxRelativeError.toStringAsExponential(2)}');
+  print('  (checksum ${sink.toStringAsExponential(3)})');
+}
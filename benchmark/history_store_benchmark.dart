@@ -0,0 +1,89 @@
+// Records a year of wallet snapshots into a HistoryStore and times range
+// queries over it:
+//
+//   dart run benchmark/history_store_benchmark.dart
+//
+// Snapshots arrive every five minutes for 365 days with eight assets, in
+// memory storage. Reported: record throughput, stored bytes per level,
+// reopen time, and the per-query cost of charting the last day, month and
+// year (the store picks the level).
+
+// ignore_for_file: avoid_print
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/services/history_storage.dart';
+import 'package:crypto_treasury/data/services/history_store.dart';
+
+const int assetCount = 8;
+const Duration interval = Duration(minutes: 5);
+const int queries = 1000;
+
+CryptoWallet walletAt(int step) => CryptoWallet(
+  address: '0x00000000000000000000000000000000000000aa',
+  chainId: 1,
+  assets: [
+    for (var i = 0; i < assetCount; i++)
+      CryptoAsset(
+        symbol: 'TKN$i',
+        name: 'Token $i',
+        amount: FixedDecimal.fromInt(1000 + (step + i) % 97),
+        logoUrl: null,
+        usdValue: FixedDecimal.fromInt(5000 + (step * (i + 1)) % 1013),
+      ),
+  ],
+);
+
+Future<void> main() async {
+  final start = DateTime.utc(2025, 1, 1);
+  final end = start.add(const Duration(days: 365));
+  final steps = end.difference(start).inMinutes ~/ interval.inMinutes;
+  final wallets = [for (var step = 0; step < 288; step++) walletAt(step)];
+
+  final storage = MemoryHistoryStorage();
+  final store = await HistoryStore.open(storage, now: start);
+  final recording = Stopwatch()..start();
+  for (var step = 0; step < steps; step++) {
+    store.record(wallets[step % wallets.length], start.add(interval * step));
+  }
+  await store.record(wallets.first, end);
+  recording.stop();
+  print(
+    'record: $steps snapshots in ${recording.elapsedMilliseconds} ms '
+    '(${(recording.elapsedMicroseconds / steps).toStringAsFixed(2)} us each)',
+  );
+
+  final segments = await storage.readAll();
+  for (final entry in segments.entries) {
+    print('  ${entry.key}: ${(entry.value.length / 1024).toStringAsFixed(0)} KB');
+  }
+
+  final reopening = Stopwatch()..start();
+  final reopened = await HistoryStore.open(storage, now: end);
+  reopening.stop();
+  print('reopen: ${reopening.elapsedMilliseconds} ms');
+
+  for (final (label, window) in [
+    ('day', const Duration(days: 1)),
+    ('month', const Duration(days: 30)),
+    ('year', const Duration(days: 365)),
+  ]) {
+    final from = end.subtract(window);
+    final watch = Stopwatch()..start();
+    var points = 0;
+    HistoryRange? range;
+    for (var i = 0; i < queries; i++) {
+      range = reopened.query(HistoryStore.totalSeries, from, end);
+      // Touches the values as a chart would.
+      for (var p = 0; p < range.length; p++) {
+        points += range.usdValues[p] > 0 ? 1 : 0;
+      }
+    }
+    watch.stop();
+    print(
+      'query $label: ${range!.length} points at ${range.resolution.name}, '
+      '${(watch.elapsedMicroseconds / queries).toStringAsFixed(1)} us '
+      '($points read)',
+    );
+  }
+}
@@ -0,0 +1,101 @@
+// Loads a synthetic 10k-token Uniswap-style list into a TokenRegistry:
+//
+//   dart run benchmark/token_registry_benchmark.dart
+//
+// Reports load time and resident-memory growth for the JSON list and for the
+// compact binary form, the number of distinct String instances behind the
+// tokens' names and symbols, and lookup cost. RSS deltas are approximate; run
+// a few times and compare the medians.
+
+// ignore_for_file: avoid_print
+import 'dart:convert';
+import 'dart:io';
+import 'dart:math';
+
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+const int tokenCount = 10000;
+const List<int> chains = [1, 10, 56, 137, 42161];
+const int lookups = 1000000;
+
+String buildTokenList(Random random) {
+  // Each symbol is deployed on every chain, as in real multi-chain lists.
+  final perChain = tokenCount ~/ chains.length;
+  final tokens = <Map<String, Object>>[];
+  for (var index = 0; index < perChain; index++) {
+    for (final chainId in chains) {
+      final address = List.generate(
+        20,
+        (_) => random.nextInt(256).toRadixString(16).padLeft(2, '0'),
+      ).join();
+      tokens.add({
+        'chainId': chainId,
+        'address': '0x$address',
+        'symbol': 'TKN$index',
+        'name': 'Token number $index',
+        'decimals': index.isEven ? 18 : 6,
+        'logoURI': 'https://tokens.example/logos/$index.png',
+      });
+    }
+  }
+  return jsonEncode({'name': 'Benchmark', 'tokens': tokens});
+}
+
+(TokenRegistry, Duration, int) measure(TokenRegistry Function() load) {
+  final rssBefore = ProcessInfo.currentRss;
+  final watch = Stopwatch()..start();
+  final registry = load();
+  watch.stop();
+  return (registry, watch.elapsed, ProcessInfo.currentRss - rssBefore);
+}
+
+int distinctInstances(Iterable<String> values) =>
+    values.map(identityHashCode).toSet().length;
+
+void main() {
+  final random = Random(11);
+  final json = buildTokenList(random);
+  final (fromJson, jsonTime, jsonRss) = measure(
+    () => TokenRegistry.parseTokenList(json),
+  );
+  final compact = fromJson.encodeCompact();
+  final (fromCompact, compactTime, compactRss) = measure(
+    () => TokenRegistry.decodeCompact(compact),
+  );
+
+  print('tokens: ${fromJson.length} on ${chains.length} chains');
+  print(
+    'json:    ${(json.length / 1024).toStringAsFixed(0)} KB, '
+    'load ${jsonTime.inMilliseconds} ms, rss +${jsonRss ~/ 1024} KB',
+  );
+  print(
+    'compact: ${(compact.length / 1024).toStringAsFixed(0)} KB, '
+    'load ${compactTime.inMilliseconds} ms, rss +${compactRss ~/ 1024} KB',
+  );
+
+  for (final (label, registry) in [('json', fromJson), ('compact', fromCompact)]) {
+    final tokens = registry.tokens.toList();
+    print(
+      '$label strings: ${distinctInstances(tokens.map((t) => t.name))} names, '
+      '${distinctInstances(tokens.map((t) => t.symbol))} symbols '
+      'for ${tokens.length} tokens',
+    );
+  }
+
+  final keys = fromJson.tokens
+      .map((token) => (token.chainId, token.address.toUpperCase()))
+      .toList();
+  final watch = Stopwatch()..start();
+  var found = 0;
+  for (var i = 0; i < lookups; i++) {
+    final (chainId, address) = keys[i % keys.length];
+    if (fromJson.lookup(chainId, address) != null) {
+      found++;
+    }
+  }
+  watch.stop();
+  print(
+    'lookup: ${(watch.elapsedMicroseconds * 1000 / lookups).toStringAsFixed(0)} '
+    'ns/op ($found hits)',
+  );
+}
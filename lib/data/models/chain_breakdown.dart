@@ -0,0 +1,44 @@
+import 'fixed_decimal.dart';
+
+// Per-chain slice of a multi-chain portfolio, with how long its reads took.
+class ChainBreakdown {
+  const ChainBreakdown({
+    required this.chainId,
+    required this.name,
+    required this.assetCount,
+    required this.usdValue,
+    required this.rpcLatency,
+    this.priceLatency,
+    this.error,
+  });
+
+  final int chainId;
+  final String name;
+  final int assetCount;
+  final FixedDecimal usdValue;
+
+  /// Round-trip of the batched balance request to the chain's RPC endpoint.
+  final Duration rpcLatency;
+
+  /// Time until prices for the chain arrived; null while still pending.
+  final Duration? priceLatency;
+
+  /// Why the chain could not be read; its assets are then missing.
+  final String? error;
+
+  ChainBreakdown copyWith({
+    int? assetCount,
+    FixedDecimal? usdValue,
+    Duration? priceLatency,
+  }) {
+    return ChainBreakdown(
+      chainId: chainId,
+      name: name,
+      assetCount: assetCount ?? this.assetCount,
+      usdValue: usdValue ?? this.usdValue,
+      rpcLatency: rpcLatency,
+      priceLatency: priceLatency ?? this.priceLatency,
+      error: error,
+    );
+  }
+}
@@ -0,0 +1,83 @@
+// Static metadata for the EVM chains the vault knows how to read.
+class ChainConfig {
+  const ChainConfig({
+    required this.chainId,
+    required this.name,
+    required this.nativeSymbol,
+    this.nativeCoingeckoId,
+    this.coingeckoPlatform,
+    this.rpcUrl,
+    this.blockTime = const Duration(seconds: 12),
+  });
+
+  final int chainId;
+  final String name;
+  final String nativeSymbol;
+  final String? nativeCoingeckoId;
+  final String? coingeckoPlatform;
+
+  /// Public read-only JSON-RPC endpoint used by the multi-chain portfolio;
+  /// null for chains that are only read through MetaMask.
+  final String? rpcUrl;
+
+  /// Typical time between blocks; the balance tracker polls at this rate.
+  final Duration blockTime;
+
+  static const Map<int, ChainConfig> known = {
+    1: ChainConfig(
+      chainId: 1,
+      name: 'Ethereum',
+      nativeSymbol: 'ETH',
+      nativeCoingeckoId: 'ethereum',
+      coingeckoPlatform: 'ethereum',
+      rpcUrl: 'https://cloudflare-eth.com',
+    ),
+    5: ChainConfig(
+      chainId: 5,
+      name: 'Goerli',
+      nativeSymbol: 'ETH',
+      nativeCoingeckoId: 'ethereum',
+    ),
+    11155111: ChainConfig(
+      chainId: 11155111,
+      name: 'Sepolia',
+      nativeSymbol: 'ETH',
+      nativeCoingeckoId: 'ethereum',
+    ),
+    137: ChainConfig(
+      chainId: 137,
+      name: 'Polygon',
+      nativeSymbol: 'MATIC',
+      nativeCoingeckoId: 'matic-network',
+      coingeckoPlatform: 'polygon-pos',
+      rpcUrl: 'https://polygon-rpc.com',
+      blockTime: Duration(seconds: 2),
+    ),
+    56: ChainConfig(
+      chainId: 56,
+      name: 'BNB Smart Chain',
+      nativeSymbol: 'BNB',
+      nativeCoingeckoId: 'binancecoin',
+      coingeckoPlatform: 'binance-smart-chain',
+      rpcUrl: 'https://bsc-dataseed.binance.org',
+      blockTime: Duration(seconds: 3),
+    ),
+  };
+
+  /// Read-only RPC endpoints of every known chain that has one.
+  static Map<int, Uri> get defaultRpcEndpoints => {
+    for (final chain in known.values)
+      if (chain.rpcUrl != null) chain.chainId: Uri.parse(chain.rpcUrl!),
+  };
+
+  static String nameOf(int chainId) => known[chainId]?.name ?? 'Unknown';
+
+  static String nativeSymbolOf(int chainId) =>
+      known[chainId]?.nativeSymbol ?? 'NATIVE';
+
+  static Duration blockTimeOf(int chainId) =>
+      known[chainId]?.blockTime ?? const Duration(seconds: 12);
+
+  /// Asset name of the native balance on [chainId].
+  static String nativeNameOf(int chainId) => '${nameOf(chainId)} Native';
+}
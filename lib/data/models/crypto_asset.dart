@@ -1,44 +1,64 @@
+import 'fixed_decimal.dart';
+
 // Defines the read-only data model for assets held within a connected wallet.
 class CryptoAsset {
-  const CryptoAsset({
+  CryptoAsset({
     required this.symbol,
     required this.name,
-    required this.balance,
-    required this.decimals,
+    required this.amount,
     required this.logoUrl,
     required this.usdValue,
+    this.chainId,
   });
 
+  /// Decimal places kept for USD values.
+  static const int usdScale = 2;
+
   final String symbol;
   final String name;
-  final BigInt balance;
-  final int decimals;
+
+  /// Balance in whole tokens; [balance] raw units at [decimals].
+  final FixedDecimal amount;
   final String? logoUrl;
-  final double usdValue;
-
-  double get normalizedBalance {
-    final divisor = BigInt.from(10).pow(decimals);
-    if (divisor == BigInt.zero) {
-      return 0;
-    }
-    return balance.toDouble() / divisor.toDouble();
+
+  /// Balance times USD price, rounded half-even to [usdScale] places.
+  final FixedDecimal usdValue;
+
+  /// Chain the asset is held on; null when the wallet is single-chain.
+  final int? chainId;
+
+  BigInt get balance => amount.units;
+
+  int get decimals => amount.scale;
+
+  double get normalizedBalance => amount.toDouble();
+
+  /// Identifies the asset within a wallet across reloads and repricing.
+  String get key => '$chainId|$symbol|$name';
+
+  /// USD value of [amount] at [usdPrice], as stored in [usdValue].
+  static FixedDecimal valueAt(FixedDecimal amount, double usdPrice) {
+    return amount.multiply(
+      FixedDecimal.fromDouble(usdPrice),
+      scale: usdScale,
+    );
   }
 
   CryptoAsset copyWith({
     String? symbol,
     String? name,
-    BigInt? balance,
-    int? decimals,
+    FixedDecimal? amount,
     String? logoUrl,
-    double? usdValue,
+    FixedDecimal? usdValue,
+    int? chainId,
   }) {
     return CryptoAsset(
       symbol: symbol ?? this.symbol,
       name: name ?? this.name,
-      balance: balance ?? this.balance,
-      decimals: decimals ?? this.decimals,
+      amount: amount ?? this.amount,
       logoUrl: logoUrl ?? this.logoUrl,
       usdValue: usdValue ?? this.usdValue,
+      chainId: chainId ?? this.chainId,
     );
   }
 }
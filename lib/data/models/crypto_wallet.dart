@@ -1,4 +1,7 @@
+
+import 'chain_breakdown.dart';
 import 'crypto_asset.dart';
+import 'fixed_decimal.dart';
 
 // Immutable representation of a connected wallet instance.
 class CryptoWallet {
@@ -6,24 +9,70 @@ class CryptoWallet {
     required this.address,
     required this.chainId,
     required this.assets,
+    this.chains = const [],
   });
 
+  /// [chainId] of a wallet merged from several chains; see [chains].
+  static const int allChains = 0;
+
   final String address;
   final int chainId;
   final List<CryptoAsset> assets;
 
-  double get totalUsdValue =>
-      assets.fold(0.0, (acc, asset) => acc + asset.usdValue);
+  /// Per-chain totals and read latency of a multi-chain wallet, in the order
+  /// the chains answered; empty for a single-chain wallet.
+  final List<ChainBreakdown> chains;
+
+  bool get isMultiChain => chainId == allChains;
+
+  FixedDecimal get totalUsdValue =>
+      assets.fold(FixedDecimal.zero, (acc, asset) => acc + asset.usdValue);
+
+  /// This wallet with every asset whose symbol is in [usdPrices] revalued at
+  /// that price and chain totals to match; the same instance when no value
+  /// changes.
+  CryptoWallet repriced(Map<String, double> usdPrices) {
+    List<CryptoAsset>? repriced;
+    for (var i = 0; i < assets.length; i++) {
+      final asset = assets[i];
+      final price = usdPrices[asset.symbol];
+      if (price == null) {
+        continue;
+      }
+      final value = CryptoAsset.valueAt(asset.amount, price);
+      if (value != asset.usdValue) {
+        (repriced ??= List.of(assets))[i] = asset.copyWith(usdValue: value);
+      }
+    }
+    if (repriced == null) {
+      return this;
+    }
+
+    FixedDecimal totalOn(int chainId) => repriced!
+        .where((asset) => asset.chainId == chainId)
+        .fold(FixedDecimal.zero, (acc, asset) => acc + asset.usdValue);
+    return copyWith(
+      assets: List.unmodifiable(repriced),
+      chains: chains.isEmpty
+          ? null
+          : List.unmodifiable([
+              for (final chain in chains)
+                chain.copyWith(usdValue: totalOn(chain.chainId)),
+            ]),
+    );
+  }
 
   CryptoWallet copyWith({
     String? address,
     int? chainId,
     List<CryptoAsset>? assets,
+    List<ChainBreakdown>? chains,
   }) {
     return CryptoWallet(
       address: address ?? this.address,
       chainId: chainId ?? this.chainId,
       assets: assets ?? this.assets,
+      chains: chains ?? this.chains,
     );
   }
 }
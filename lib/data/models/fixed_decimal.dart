@@ -0,0 +1,204 @@
+// Exact fixed-point decimals for on-chain balances and USD valuations.
+
+/// How [FixedDecimal.rescale] and [FixedDecimal.multiply] round dropped digits.
+enum DecimalRounding { down, halfUp, halfEven }
+
+/// An exact decimal: [units] × 10^-[scale], e.g. a raw ERC-20 balance with
+/// its token decimals.
+///
+/// Powers of ten come from tables built once, and [toDouble] is computed on
+/// first use and cached, so reading a balance for display or the Unity
+/// payload never touches BigInt.
+class FixedDecimal implements Comparable<FixedDecimal> {
+  FixedDecimal(this.units, this.scale) {
+    if (scale < 0 || scale > maxScale) {
+      throw RangeError.range(scale, 0, maxScale, 'scale');
+    }
+  }
+
+  FixedDecimal.fromInt(int value) : this(BigInt.from(value), 0);
+
+  /// Parses a plain or exponent decimal string such as `-12.5` or `1.2e-7`.
+  factory FixedDecimal.parse(String source) {
+    final text = source.trim().toLowerCase();
+    final exponentAt = text.indexOf('e');
+    final mantissa = exponentAt == -1 ? text : text.substring(0, exponentAt);
+    final exponent = exponentAt == -1
+        ? 0
+        : int.parse(text.substring(exponentAt + 1));
+
+    final pointAt = mantissa.indexOf('.');
+    final digits = pointAt == -1
+        ? mantissa
+        : mantissa.substring(0, pointAt) + mantissa.substring(pointAt + 1);
+    final fractionDigits = pointAt == -1 ? 0 : mantissa.length - pointAt - 1;
+    if (digits.isEmpty || digits == '-' || digits == '+') {
+      throw FormatException('Invalid decimal', source);
+    }
+
+    final units = BigInt.parse(digits);
+    final scale = fractionDigits - exponent;
+    return scale >= 0
+        ? FixedDecimal(units, scale)
+        : FixedDecimal(units * _pow10(-scale), 0);
+  }
+
+  /// The shortest decimal that round-trips [value], e.g. a price from an API.
+  factory FixedDecimal.fromDouble(double value) {
+    if (!value.isFinite) {
+      throw ArgumentError.value(value, 'value', 'must be finite');
+    }
+    return FixedDecimal.parse(value.toString());
+  }
+
+  static final FixedDecimal zero = FixedDecimal(BigInt.zero, 0);
+
+  /// Largest supported scale; covers token decimals times price precision.
+  static const int maxScale = 96;
+
+  static final List<BigInt> _bigPowers = List<BigInt>.generate(
+    maxScale + 1,
+    (index) => BigInt.from(10).pow(index),
+    growable: false,
+  );
+
+  static final List<double> _doublePowers = List<double>.generate(
+    maxScale + 1,
+    (index) => double.parse('1e$index'),
+    growable: false,
+  );
+
+  final BigInt units;
+  final int scale;
+
+  late final double _double = _toDouble();
+
+  bool get isNegative => units.isNegative;
+
+  bool get isZero => units == BigInt.zero;
+
+  /// Nearest double, cached after the first call.
+  double toDouble() => _double;
+
+  /// This value at [newScale], rounding dropped digits with [rounding].
+  FixedDecimal rescale(
+    int newScale, {
+    DecimalRounding rounding = DecimalRounding.halfEven,
+  }) {
+    if (newScale == scale) {
+      return this;
+    }
+    if (newScale > scale) {
+      return FixedDecimal(units * _pow10(newScale - scale), newScale);
+    }
+    return FixedDecimal(
+      _divideRounded(units, _pow10(scale - newScale), rounding),
+      newScale,
+    );
+  }
+
+  /// Exact product of this and [other] at [scale] (defaults to the exact
+  /// scale), e.g. a balance times a USD price rounded to cents.
+  FixedDecimal multiply(
+    FixedDecimal other, {
+    int? scale,
+    DecimalRounding rounding = DecimalRounding.halfEven,
+  }) {
+    final product = FixedDecimal(units * other.units, this.scale + other.scale);
+    return scale == null ? product : product.rescale(scale, rounding: rounding);
+  }
+
+  FixedDecimal operator +(FixedDecimal other) {
+    if (other.scale == scale) {
+      return FixedDecimal(units + other.units, scale);
+    }
+    final common = scale > other.scale ? scale : other.scale;
+    return FixedDecimal(
+      rescale(common).units + other.rescale(common).units,
+      common,
+    );
+  }
+
+  FixedDecimal operator -() => FixedDecimal(-units, scale);
+
+  FixedDecimal operator -(FixedDecimal other) => this + -other;
+
+  @override
+  int compareTo(FixedDecimal other) {
+    if (other.scale == scale) {
+      return units.compareTo(other.units);
+    }
+    final common = scale > other.scale ? scale : other.scale;
+    return rescale(common).units.compareTo(other.rescale(common).units);
+  }
+
+  @override
+  bool operator ==(Object other) =>
+      other is FixedDecimal && compareTo(other) == 0;
+
+  @override
+  int get hashCode => _trimmed().units.hashCode;
+
+  /// Exact decimal string, keeping every digit of [scale].
+  @override
+  String toString() {
+    final digits = units.abs().toString().padLeft(scale + 1, '0');
+    final sign = units.isNegative ? '-' : '';
+    if (scale == 0) {
+      return '$sign$digits';
+    }
+    final whole = digits.substring(0, digits.length - scale);
+    final fraction = digits.substring(digits.length - scale);
+    return '$sign$whole.$fraction';
+  }
+
+  double _toDouble() {
+    if (scale == 0) {
+      return units.toDouble();
+    }
+    // Splitting keeps precision for balances far larger than 2^53 units.
+    final divisor = _pow10(scale);
+    final whole = units ~/ divisor;
+    final fraction = units.remainder(divisor);
+    return whole.toDouble() + fraction.toDouble() / _doublePowers[scale];
+  }
+
+  FixedDecimal _trimmed() {
+    var value = this;
+    final ten = _bigPowers[1];
+    while (value.scale > 0 && value.units.remainder(ten) == BigInt.zero) {
+      value = FixedDecimal(value.units ~/ ten, value.scale - 1);
+    }
+    return value;
+  }
+
+  static BigInt _pow10(int exponent) {
+    if (exponent > maxScale) {
+      throw RangeError.range(exponent, 0, maxScale, 'exponent');
+    }
+    return _bigPowers[exponent];
+  }
+
+  static BigInt _divideRounded(
+    BigInt value,
+    BigInt divisor,
+    DecimalRounding rounding,
+  ) {
+    final quotient = value ~/ divisor;
+    final remainder = value.remainder(divisor).abs();
+    if (rounding == DecimalRounding.down || remainder == BigInt.zero) {
+      return quotient;
+    }
+
+    final twice = remainder * BigInt.two;
+    final roundAway = switch (twice.compareTo(divisor)) {
+      > 0 => true,
+      < 0 => false,
+      _ => rounding == DecimalRounding.halfUp || quotient.isOdd,
+    };
+    if (!roundAway) {
+      return quotient;
+    }
+    return value.isNegative ? quotient - BigInt.one : quotient + BigInt.one;
+  }
+}
@@ -0,0 +1,58 @@
+import 'package:flutter/foundation.dart';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/services/history_storage.dart';
+import 'package:crypto_treasury/data/services/history_storage_platform.dart'
+    as platform;
+import 'package:crypto_treasury/data/services/history_store.dart';
+
+/// Local wallet history, one HistoryStore per address and chain (or
+/// portfolio), opened on first use.
+class HistoryRepository {
+  HistoryRepository({
+    HistoryStorage Function(String namespace)? openStorage,
+    DateTime Function()? clock,
+  }) : _openStorage = openStorage ?? platform.openHistoryStorage,
+       _clock = clock ?? DateTime.now;
+
+  final HistoryStorage Function(String namespace) _openStorage;
+  final DateTime Function() _clock;
+  final Map<String, Future<HistoryStore>> _stores = {};
+
+  static String namespaceOf(CryptoWallet wallet) =>
+      '${wallet.address.toLowerCase()}-${wallet.chainId}';
+
+  Future<HistoryStore> storeFor(CryptoWallet wallet) {
+    return _stores.putIfAbsent(
+      namespaceOf(wallet),
+      () => HistoryStore.open(
+        _openStorage(namespaceOf(wallet)),
+        now: _clock(),
+      ),
+    );
+  }
+
+  /// Adds a snapshot of [wallet] now. Storage failures are logged, not
+  /// thrown, so history never interrupts the wallet itself.
+  Future<void> record(CryptoWallet wallet) async {
+    try {
+      final store = await storeFor(wallet);
+      await store.record(wallet, _clock());
+    } catch (error) {
+      debugPrint('[HistoryRepository] record failed: $error');
+    }
+  }
+
+  /// [series] of [wallet] (default: its total USD value) over [window] up to
+  /// now; see HistoryStore.query.
+  Future<HistoryRange> query(
+    CryptoWallet wallet, {
+    String series = HistoryStore.totalSeries,
+    required Duration window,
+    int maxPoints = 1000,
+  }) async {
+    final store = await storeFor(wallet);
+    final now = _clock();
+    return store.query(series, now.subtract(window), now, maxPoints: maxPoints);
+  }
+}
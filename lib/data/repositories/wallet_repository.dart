@@ -1,17 +1,37 @@
+import 'package:flutter/foundation.dart';
+
+import 'package:crypto_treasury/data/models/chain_config.dart';
 import 'package:crypto_treasury/data/models/crypto_wallet.dart';
 import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/balance_tracker.dart';
 import 'package:crypto_treasury/data/services/metamask_service.dart';
+import 'package:crypto_treasury/data/services/portfolio_service.dart';
+import 'package:crypto_treasury/data/services/price_feed.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
 
 class WalletRepository {
   WalletRepository({
     MetamaskService? metamaskService,
+    PortfolioService? portfolioService,
+    PriceFeed? priceFeed,
     List<TrackedToken>? trackedTokens,
+    this.tokenListUri,
   }) : _metamaskService = metamaskService ?? MetamaskService(),
+       _portfolioService = portfolioService ?? PortfolioService(),
+       _priceFeed = priceFeed ?? PriceFeed(),
        _trackedTokens = trackedTokens ?? _defaultTrackedTokens;
 
   final MetamaskService _metamaskService;
+  final PortfolioService _portfolioService;
+  final PriceFeed _priceFeed;
   final List<TrackedToken> _trackedTokens;
 
+  /// Token list (JSON or compact, see TokenRegistry) fetched on the first
+  /// wallet load; [_trackedTokens] is used when unset or unreachable.
+  final Uri? tokenListUri;
+
+  late final Future<TokenRegistry> _tokenRegistry = _loadTokenRegistry();
+
   static const List<TrackedToken> _defaultTrackedTokens = [
     TrackedToken(
       chainId: 1,
@@ -72,36 +92,119 @@ class WalletRepository {
 
   Stream<int> get chainStream => _metamaskService.chainStream;
 
-  Future<CryptoWallet?> connectWallet() {
-    return _metamaskService.connectAndLoadWallet(trackedTokens: _trackedTokens);
+  // Each stream emits progressively more complete wallets; see
+  // MetamaskService.watchWallet.
+  Stream<CryptoWallet> connectWallet() {
+    return _withTokens(
+      (tokens) => _metamaskService.connectAndWatchWallet(tokenRegistry: tokens),
+    );
   }
 
-  Future<CryptoWallet?> refreshWallet() {
+  Stream<CryptoWallet> refreshWallet() {
     final address = currentAccount;
     final chainId = currentChainId;
     if (address == null || chainId == null) {
-      return Future.value(null);
+      return const Stream.empty();
     }
-    return _metamaskService.loadWallet(
-      address: address,
-      chainId: chainId,
-      trackedTokens: _trackedTokens,
+    return _withTokens(
+      (tokens) => _metamaskService.watchWallet(
+        address: address,
+        chainId: chainId,
+        tokenRegistry: tokens,
+      ),
     );
   }
 
-  Future<CryptoWallet?> loadWallet({
+  Stream<CryptoWallet> loadWallet({
     required String address,
     required int chainId,
   }) {
-    return _metamaskService.loadWallet(
-      address: address,
-      chainId: chainId,
-      trackedTokens: _trackedTokens,
+    return _withTokens(
+      (tokens) => _metamaskService.watchWallet(
+        address: address,
+        chainId: chainId,
+        tokenRegistry: tokens,
+      ),
+    );
+  }
+
+  /// Every configured chain for [address] (default: the connected account),
+  /// read in parallel over public RPC; see PortfolioService.watchPortfolio.
+  Stream<CryptoWallet> loadPortfolio({String? address}) {
+    final owner = address ?? currentAccount;
+    if (owner == null) {
+      return const Stream.empty();
+    }
+    return _withTokens(
+      (tokens) =>
+          _portfolioService.watchPortfolio(address: owner, tokenRegistry: tokens),
     );
   }
 
+  /// Keeps [wallet] current from new blocks over the chain's public RPC; see
+  /// BalanceTracker. Empty for portfolios and chains without an endpoint.
+  Stream<CryptoWallet> trackWallet(CryptoWallet wallet) {
+    final client = wallet.isMultiChain
+        ? null
+        : _portfolioService.clientFor(wallet.chainId);
+    if (client == null) {
+      return const Stream.empty();
+    }
+    return _withTokens(
+      (tokens) =>
+          BalanceTracker(client: client, tokenRegistry: tokens).track(wallet),
+    );
+  }
+
+  /// Live USD prices for the symbols held in [wallet], keyed by symbol; see
+  /// PriceFeed.
+  Stream<Map<String, double>> watchPrices(CryptoWallet wallet) {
+    return _withTokens((tokens) {
+      final coingeckoIds = <String, String?>{
+        for (final asset in wallet.assets) asset.symbol: null,
+      };
+      final chainIds = {
+        for (final asset in wallet.assets) asset.chainId ?? wallet.chainId,
+      };
+      for (final chainId in chainIds) {
+        final chain = ChainConfig.known[chainId];
+        if (chain != null && coingeckoIds.containsKey(chain.nativeSymbol)) {
+          coingeckoIds[chain.nativeSymbol] ??= chain.nativeCoingeckoId;
+        }
+        for (final token in tokens.tokensOn(chainId)) {
+          if (coingeckoIds.containsKey(token.symbol)) {
+            coingeckoIds[token.symbol] ??= token.coingeckoId;
+          }
+        }
+      }
+      return _priceFeed.watch(coingeckoIds);
+    });
+  }
+
+  Stream<T> _withTokens<T>(
+    Stream<T> Function(TokenRegistry tokens) watch,
+  ) async* {
+    yield* watch(await _tokenRegistry);
+  }
+
+  Future<TokenRegistry> _loadTokenRegistry() async {
+    final uri = tokenListUri;
+    if (uri != null) {
+      try {
+        final registry = await TokenRegistry.load(uri);
+        debugPrint('[WalletRepository] loaded ${registry.length} tokens from $uri');
+        return registry;
+      } catch (error) {
+        debugPrint('[WalletRepository] token list $uri failed: $error');
+      }
+    }
+    return TokenRegistry.fromTokens(_trackedTokens);
+  }
+
   void dispose() {
     _metamaskService.dispose();
+    _portfolioService.dispose();
+    _priceFeed.dispose();
   }
 }
 
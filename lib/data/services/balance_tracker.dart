@@ -0,0 +1,353 @@
+import 'dart:async';
+
+import 'package:flutter/foundation.dart';
+
+import 'package:crypto_treasury/data/models/chain_config.dart';
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/json_rpc_client.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+/// Keeps an already loaded single-chain wallet current from new blocks
+/// instead of re-reading every balance.
+///
+/// Each tick is one batched round trip: the head block, plus the native
+/// balance and the ERC-20 `Transfer` logs from and to the owner in the blocks
+/// between the last scan and the head the previous tick saw. Scans therefore
+/// have fixed bounds and trail the head by one tick; a tick with no new
+/// block reads the head alone. Transfers are applied as deltas right away,
+/// then only the tokens they touched are re-read with `balanceOf`, which
+/// also corrects any transfer counted twice.
+///
+/// After more than [maxBlockRange] blocks without a tick (a sleeping tab, a
+/// dropped connection) the logs are not scanned; every held token is re-read
+/// instead.
+///
+/// Ticks follow [newBlocks] when given (e.g. a `newHeads` subscription) and
+/// otherwise poll every [pollInterval] (default: the chain's block time, see
+/// ChainConfig.blockTimeOf). A block that arrives during a tick
+/// runs one more once it ends. A failed tick is retried on the next.
+class BalanceTracker {
+  BalanceTracker({
+    required this.client,
+    required this.tokenRegistry,
+    this.pollInterval,
+    this.maxBlockRange = 1000,
+    this.newBlocks,
+  });
+
+  final JsonRpcClient client;
+  final TokenRegistry tokenRegistry;
+  final Duration? pollInterval;
+
+  /// Most blocks scanned for logs in one tick; public nodes cap the range
+  /// of `eth_getLogs`.
+  final int maxBlockRange;
+
+  final Stream<Object?>? newBlocks;
+
+  /// Emits [wallet] again, with updated assets, whenever its balances change.
+  /// Tokens from the registry that the owner receives are appended.
+  Stream<CryptoWallet> track(CryptoWallet wallet) {
+    if (wallet.isMultiChain) {
+      throw ArgumentError.value(wallet.chainId, 'wallet', 'must be single-chain');
+    }
+    late final _TrackingSession session;
+    final controller = StreamController<CryptoWallet>(
+      onListen: () => session.start(),
+      onCancel: () => session.stop(),
+    );
+    session = _TrackingSession(this, wallet, controller);
+    return controller.stream;
+  }
+}
+
+class _TrackingSession {
+  _TrackingSession(this.tracker, CryptoWallet wallet, this.output)
+    : _wallet = wallet,
+      _ownerTopic = JsonRpcRequest.addressTopic(wallet.address) {
+    for (final asset in wallet.assets) {
+      if (!asset.amount.isZero) {
+        _unitPrices[_keyOf(asset.symbol, asset.name)] =
+            asset.usdValue.toDouble() / asset.amount.toDouble();
+      }
+    }
+  }
+
+  final BalanceTracker tracker;
+  final StreamController<CryptoWallet> output;
+  final String _ownerTopic;
+  CryptoWallet _wallet;
+
+  // First block not yet scanned and the latest head seen; null until the
+  // first tick reads the head.
+  int? _nextBlock;
+  int? _head;
+  bool _polling = false;
+  bool _tickAgain = false;
+  bool _stopped = false;
+  Timer? _timer;
+  StreamSubscription<Object?>? _blocks;
+
+  // Logs already applied, keyed by transaction, log index and direction,
+  // with their block so old entries can be dropped.
+  final Map<String, int> _appliedLogs = {};
+  final Map<String, double> _unitPrices = {};
+
+  int get _chainId => _wallet.chainId;
+
+  void start() {
+    final blocks = tracker.newBlocks;
+    if (blocks != null) {
+      _blocks = blocks.listen((_) => _tick());
+    } else {
+      _timer = Timer.periodic(
+        tracker.pollInterval ?? ChainConfig.blockTimeOf(_chainId),
+        (_) => _tick(),
+      );
+    }
+    _tick();
+  }
+
+  void stop() {
+    _stopped = true;
+    _timer?.cancel();
+    _blocks?.cancel();
+  }
+
+  Future<void> _tick() async {
+    if (_stopped) {
+      return;
+    }
+    if (_polling) {
+      _tickAgain = true;
+      return;
+    }
+    _polling = true;
+    try {
+      do {
+        _tickAgain = false;
+        await _step();
+      } while (_tickAgain && !_stopped);
+    } finally {
+      _polling = false;
+    }
+  }
+
+  Future<void> _step() async {
+    try {
+      final from = _nextBlock;
+      final to = _head;
+      if (from == null || to == null || to < from) {
+        final results = await tracker.client.batch(const [
+          JsonRpcRequest.blockNumber(),
+        ]);
+        _head = _quantity(results.first).toInt();
+        // The wallet was read at about this block; rescanning it is safe
+        // because every transfer found is verified.
+        _nextBlock ??= _head;
+      } else if (to - from >= tracker.maxBlockRange) {
+        await _resync(to);
+      } else {
+        await _scan(from, to);
+      }
+    } catch (error) {
+      debugPrint('[BalanceTracker] chain $_chainId tick failed: $error');
+    }
+  }
+
+  Future<void> _scan(int from, int to) async {
+    final results = await tracker.client.batch([
+      const JsonRpcRequest.blockNumber(),
+      JsonRpcRequest.getBalance(_wallet.address, block: to),
+      JsonRpcRequest.getLogs(
+        fromBlock: from,
+        toBlock: to,
+        topics: [JsonRpcRequest.transferTopic, _ownerTopic],
+      ),
+      JsonRpcRequest.getLogs(
+        fromBlock: from,
+        toBlock: to,
+        topics: [JsonRpcRequest.transferTopic, null, _ownerTopic],
+      ),
+    ]);
+    final head = _quantity(results[0]).toInt();
+    final native = _quantity(results[1]);
+
+    // Logs are only marked applied once the whole scan has been read, so a
+    // failed tick rescans the same range without skipping any of them.
+    final applied = <String, int>{};
+    final deltas = <TrackedToken, BigInt>{};
+    void collect(Object? logs, {required bool incoming}) {
+      if (logs is JsonRpcException) {
+        throw logs;
+      }
+      for (final log in (logs as List).whereType<Map>()) {
+        final block = _quantity(log['blockNumber']).toInt();
+        final key = '${log['transactionHash']}:${log['logIndex']}:$incoming';
+        final topics = log['topics'];
+        // ERC-721 Transfer shares the topic but indexes the token id.
+        if (topics is! List || topics.length != 3 || log['removed'] == true) {
+          continue;
+        }
+        final token = tracker.tokenRegistry.lookup(
+          _chainId,
+          log['address'].toString(),
+        );
+        if (token == null ||
+            _appliedLogs.containsKey(key) ||
+            applied.containsKey(key)) {
+          continue;
+        }
+        applied[key] = block;
+        final value = _quantity(log['data']);
+        deltas[token] =
+            (deltas[token] ?? BigInt.zero) + (incoming ? value : -value);
+      }
+    }
+
+    collect(results[2], incoming: false);
+    collect(results[3], incoming: true);
+    _appliedLogs
+      ..removeWhere((_, block) => block < from)
+      ..addAll(applied);
+    _nextBlock = to + 1;
+    _head = head;
+
+    final assets = List.of(_wallet.assets);
+    var changed = _applyNative(assets, native);
+
+    for (final MapEntry(key: token, value: delta) in deltas.entries) {
+      final at = _indexOf(assets, token);
+      if (at == -1) {
+        assets.add(_newAsset(token, delta.isNegative ? BigInt.zero : delta));
+        changed = true;
+      } else if (delta != BigInt.zero) {
+        final previous = assets[at];
+        assets[at] = _withAmount(
+          previous,
+          FixedDecimal(previous.balance + delta, token.decimals),
+        );
+        changed = true;
+      }
+    }
+    if (changed) {
+      _emit(assets);
+    }
+    if (deltas.isNotEmpty) {
+      await _verify(deltas.keys.toList());
+    }
+  }
+
+  // Brings the wallet to [head] by re-reading the native balance and every
+  // held registry token. Tokens first received in the skipped blocks appear
+  // on the next reload.
+  Future<void> _resync(int head) async {
+    final results = await tracker.client.batch([
+      const JsonRpcRequest.blockNumber(),
+      JsonRpcRequest.getBalance(_wallet.address, block: head),
+    ]);
+    final latest = _quantity(results[0]).toInt();
+    final assets = List.of(_wallet.assets);
+    if (_applyNative(assets, _quantity(results[1]))) {
+      _emit(assets);
+    }
+    await _verify([
+      for (final token in tracker.tokenRegistry.tokensOn(_chainId))
+        if (_indexOf(_wallet.assets, token) != -1) token,
+    ]);
+    _appliedLogs.clear();
+    _nextBlock = head + 1;
+    _head = latest;
+  }
+
+  bool _applyNative(List<CryptoAsset> assets, BigInt native) {
+    final at = assets.indexWhere(
+      (asset) =>
+          asset.symbol == ChainConfig.nativeSymbolOf(_chainId) &&
+          asset.name == ChainConfig.nativeNameOf(_chainId),
+    );
+    if (at == -1 || assets[at].balance == native) {
+      return false;
+    }
+    assets[at] = _withAmount(assets[at], FixedDecimal(native, 18));
+    return true;
+  }
+
+  // Re-reads the balances of [tokens] and overwrites the applied deltas.
+  Future<void> _verify(List<TrackedToken> tokens) async {
+    final results = await tracker.client.batch([
+      for (final token in tokens)
+        JsonRpcRequest.balanceOf(token.address, _wallet.address),
+    ]);
+    final assets = List.of(_wallet.assets);
+    var changed = false;
+    for (var i = 0; i < tokens.length; i++) {
+      final result = results[i];
+      final at = _indexOf(assets, tokens[i]);
+      if (result is JsonRpcException || at == -1) {
+        continue;
+      }
+      final balance = _quantity(result);
+      if (assets[at].balance != balance) {
+        assets[at] = _withAmount(
+          assets[at],
+          FixedDecimal(balance, tokens[i].decimals),
+        );
+        changed = true;
+      }
+    }
+    if (changed) {
+      _emit(assets);
+    }
+  }
+
+  void _emit(List<CryptoAsset> assets) {
+    _wallet = _wallet.copyWith(assets: List.unmodifiable(assets));
+    if (!_stopped) {
+      output.add(_wallet);
+    }
+  }
+
+  CryptoAsset _withAmount(CryptoAsset asset, FixedDecimal amount) {
+    final price = _unitPrices[_keyOf(asset.symbol, asset.name)] ?? 0;
+    return asset.copyWith(
+      amount: amount,
+      usdValue: CryptoAsset.valueAt(amount, price),
+    );
+  }
+
+  CryptoAsset _newAsset(TrackedToken token, BigInt balance) {
+    _unitPrices[_keyOf(token.symbol, token.name)] = PriceService.resolveUsdPrice(
+      token,
+      const {},
+    );
+    return _withAmount(
+      CryptoAsset(
+        symbol: token.symbol,
+        name: token.name,
+        amount: FixedDecimal.zero,
+        logoUrl: token.logoUrl,
+        usdValue: FixedDecimal.zero,
+      ),
+      FixedDecimal(balance, token.decimals),
+    );
+  }
+
+  static int _indexOf(List<CryptoAsset> assets, TrackedToken token) =>
+      assets.indexWhere(
+        (asset) => asset.symbol == token.symbol && asset.name == token.name,
+      );
+
+  static String _keyOf(String symbol, String name) => '$symbol|$name';
+
+  static BigInt _quantity(Object? value) {
+    if (value is JsonRpcException) {
+      throw value;
+    }
+    return JsonRpcClient.parseQuantity(value);
+  }
+}
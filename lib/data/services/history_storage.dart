@@ -0,0 +1,34 @@
+import 'dart:typed_data';
+
+/// Append-only byte segments behind a HistoryStore, one namespace per
+/// wallet. See `history_storage_platform.dart` for the persistent backends.
+abstract class HistoryStorage {
+  /// Every segment's bytes in append order, keyed by segment name.
+  Future<Map<String, Uint8List>> readAll();
+
+  Future<void> append(String segment, Uint8List bytes);
+
+  /// Rewrites [segment] with [bytes], e.g. after dropping expired rows.
+  Future<void> replace(String segment, Uint8List bytes);
+}
+
+/// Keeps segments in memory; used in tests and when no persistent backend
+/// is available.
+class MemoryHistoryStorage implements HistoryStorage {
+  final Map<String, BytesBuilder> _segments = {};
+
+  @override
+  Future<Map<String, Uint8List>> readAll() async => {
+    for (final entry in _segments.entries) entry.key: entry.value.toBytes(),
+  };
+
+  @override
+  Future<void> append(String segment, Uint8List bytes) async {
+    _segments.putIfAbsent(segment, BytesBuilder.new).add(bytes);
+  }
+
+  @override
+  Future<void> replace(String segment, Uint8List bytes) async {
+    _segments[segment] = BytesBuilder()..add(bytes);
+  }
+}
@@ -0,0 +1,54 @@
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'history_storage.dart';
+
+/// Files under `$XDG_DATA_HOME/crypto_treasury/history/<namespace>`, one per
+/// segment.
+HistoryStorage openHistoryStorage(String namespace) {
+  final env = Platform.environment;
+  final home = env['HOME'];
+  final dataHome = env['XDG_DATA_HOME'] ??
+      (home == null ? Directory.systemTemp.path : '$home/.local/share');
+  return FileHistoryStorage(
+    Directory('$dataHome/crypto_treasury/history/$namespace'),
+  );
+}
+
+/// Each segment is an append-only `<segment>.bin` file, read whole on open.
+class FileHistoryStorage implements HistoryStorage {
+  FileHistoryStorage(this.directory);
+
+  final Directory directory;
+
+  File _fileOf(String segment) => File('${directory.path}/$segment.bin');
+
+  @override
+  Future<Map<String, Uint8List>> readAll() async {
+    if (!await directory.exists()) {
+      return {};
+    }
+    final segments = <String, Uint8List>{};
+    await for (final entry in directory.list()) {
+      final name = entry.uri.pathSegments.last;
+      if (entry is File && name.endsWith('.bin')) {
+        segments[name.substring(0, name.length - 4)] = await entry.readAsBytes();
+      }
+    }
+    return segments;
+  }
+
+  @override
+  Future<void> append(String segment, Uint8List bytes) async {
+    await directory.create(recursive: true);
+    await _fileOf(segment).writeAsBytes(bytes, mode: FileMode.append);
+  }
+
+  @override
+  Future<void> replace(String segment, Uint8List bytes) async {
+    await directory.create(recursive: true);
+    final temp = File('${_fileOf(segment).path}.tmp');
+    await temp.writeAsBytes(bytes, flush: true);
+    await temp.rename(_fileOf(segment).path);
+  }
+}
@@ -0,0 +1,2 @@
+export 'history_storage_io.dart'
+    if (dart.library.html) 'history_storage_web.dart';
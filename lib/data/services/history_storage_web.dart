@@ -0,0 +1,94 @@
+// ignore: avoid_web_libraries_in_flutter
+import 'dart:html' as html;
+// ignore: avoid_web_libraries_in_flutter
+import 'dart:indexed_db' as idb;
+import 'dart:typed_data';
+
+import 'history_storage.dart';
+
+HistoryStorage openHistoryStorage(String namespace) =>
+    IndexedDbHistoryStorage(namespace);
+
+/// Segments as appended chunks in one IndexedDB object store, keyed by
+/// `<namespace>/<segment>` and read back in insertion order.
+class IndexedDbHistoryStorage implements HistoryStorage {
+  IndexedDbHistoryStorage(this.namespace);
+
+  final String namespace;
+
+  static const String _database = 'vault_history';
+  static const String _chunks = 'chunks';
+  static const String _bySegment = 'segment';
+
+  static final Future<idb.Database> _db = html.window.indexedDB!.open(
+    _database,
+    version: 1,
+    onUpgradeNeeded: (event) {
+      final db = (event.target as idb.Request).result as idb.Database;
+      db
+          .createObjectStore(_chunks, autoIncrement: true)
+          .createIndex(_bySegment, 'segment');
+    },
+  );
+
+  String _keyOf(String segment) => '$namespace/$segment';
+
+  @override
+  Future<Map<String, Uint8List>> readAll() async {
+    final db = await _db;
+    final transaction = db.transaction(_chunks, 'readonly');
+    final chunks = <String, BytesBuilder>{};
+    final cursors = transaction
+        .objectStore(_chunks)
+        .index(_bySegment)
+        .openCursor(
+          range: idb.KeyRange.bound('$namespace/', '$namespace/\uffff'),
+          autoAdvance: true,
+        );
+    await for (final cursor in cursors) {
+      final value = cursor.value as Map;
+      final segment = (value['segment'] as String).substring(
+        namespace.length + 1,
+      );
+      chunks
+          .putIfAbsent(segment, BytesBuilder.new)
+          .add(_bytesOf(value['bytes']));
+    }
+    await transaction.completed;
+    return {
+      for (final entry in chunks.entries) entry.key: entry.value.takeBytes(),
+    };
+  }
+
+  @override
+  Future<void> append(String segment, Uint8List bytes) async {
+    final db = await _db;
+    final transaction = db.transaction(_chunks, 'readwrite');
+    transaction.objectStore(_chunks).add({
+      'segment': _keyOf(segment),
+      'bytes': bytes,
+    });
+    await transaction.completed;
+  }
+
+  @override
+  Future<void> replace(String segment, Uint8List bytes) async {
+    final db = await _db;
+    final transaction = db.transaction(_chunks, 'readwrite');
+    final store = transaction.objectStore(_chunks);
+    final existing = store
+        .index(_bySegment)
+        .openCursor(key: _keyOf(segment), autoAdvance: true);
+    await for (final cursor in existing) {
+      cursor.delete();
+    }
+    store.add({'segment': _keyOf(segment), 'bytes': bytes});
+    await transaction.completed;
+  }
+
+  static Uint8List _bytesOf(Object? value) => switch (value) {
+    Uint8List bytes => bytes,
+    ByteBuffer buffer => buffer.asUint8List(),
+    _ => Uint8List(0),
+  };
+}
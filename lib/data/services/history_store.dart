@@ -0,0 +1,489 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/services/history_storage.dart';
+
+/// Time-series levels of a [HistoryStore], finest first. Each level keeps
+/// the last value of every bucket for [retention] (forever when null).
+enum HistoryResolution {
+  raw(Duration.zero, Duration(days: 1)),
+  minute(Duration(minutes: 1), Duration(days: 7)),
+  hour(Duration(hours: 1), Duration(days: 90)),
+  day(Duration(days: 1), null);
+
+  const HistoryResolution(this.bucket, this.retention);
+
+  final Duration bucket;
+  final Duration? retention;
+}
+
+/// Points of one series between two times at one resolution. The lists are
+/// views into the store and stay valid until the next [HistoryStore.record].
+class HistoryRange {
+  HistoryRange(this.resolution, this.times, this.balances, this.usdValues);
+
+  HistoryRange.empty(this.resolution)
+    : times = Float64List(0),
+      balances = Float64List(0),
+      usdValues = Float64List(0);
+
+  final HistoryResolution resolution;
+
+  /// Milliseconds since the epoch (bucket start for downsampled levels).
+  final Float64List times;
+  final Float64List balances;
+  final Float64List usdValues;
+
+  int get length => times.length;
+}
+
+/// Local history of one wallet: per-asset balance and USD value, plus the
+/// wallet total, downsampled from raw snapshots to 1m, 1h and 1d buckets.
+///
+/// In memory every series is three parallel Float64List columns per level,
+/// so a range query is two binary searches and three list views. On storage
+/// each level is an append-only segment of blocks, one per snapshot or
+/// closed bucket, laid out column by column: f64 time, u16 row count, u16
+/// series ids, f64 balances, f64 USD values. Series names live in the
+/// `series` segment in id order. Buckets still open are not written; they
+/// are rebuilt from the finer level on [open].
+class HistoryStore {
+  HistoryStore._(this._storage);
+
+  /// Opens the history in [storage], dropping rows older than each level's
+  /// retention at [now].
+  static Future<HistoryStore> open(
+    HistoryStorage storage, {
+    required DateTime now,
+  }) async {
+    final store = HistoryStore._(storage);
+    await store._load(now.millisecondsSinceEpoch.toDouble());
+    return store;
+  }
+
+  /// Series holding the wallet's total USD value (balance is always 0).
+  static const String totalSeries = '*';
+
+  /// Raw snapshots closer together than this are only folded into the
+  /// downsampled levels.
+  static const Duration minRawInterval = Duration(seconds: 10);
+
+  static const String _seriesSegment = 'series';
+  static const int _blockHeader = 10;
+  static const int _bytesPerRow = 18;
+
+  /// Series name of [symbol] on [chainId] (the wallet's chain when null):
+  /// `<chainId>:<symbol>`.
+  static String seriesOf(CryptoWallet wallet, int? chainId, String symbol) =>
+      '${chainId ?? wallet.chainId}:$symbol';
+
+  final HistoryStorage _storage;
+  final List<String> _names = [];
+  final Map<String, int> _ids = {};
+  final List<_Level> _levels = [
+    for (final resolution in HistoryResolution.values) _Level(resolution),
+  ];
+  Future<void> _writes = Future.value();
+
+  Iterable<String> get series => _names;
+
+  /// Time of the latest snapshot, if any.
+  DateTime? get lastRecorded {
+    final last = _levels.first.lastTime;
+    return last == null
+        ? null
+        : DateTime.fromMillisecondsSinceEpoch(last.toInt());
+  }
+
+  /// Appends a snapshot of [wallet] taken at [at]. Snapshots older than the
+  /// latest are ignored. Completes once the writes it caused are stored.
+  Future<void> record(CryptoWallet wallet, DateTime at) {
+    final time = at.millisecondsSinceEpoch.toDouble();
+    final raw = _levels.first;
+    final latest = raw.pendingTime ?? raw.lastTime;
+    if (latest != null && time < latest) {
+      return _writes;
+    }
+
+    final values = <int, (double, double)>{
+      _idOf(totalSeries): (0, wallet.totalUsdValue.toDouble()),
+    };
+    for (final asset in wallet.assets) {
+      final id = _idOf(seriesOf(wallet, asset.chainId, asset.symbol));
+      final (balance, usd) = values[id] ?? (0.0, 0.0);
+      values[id] = (
+        balance + asset.normalizedBalance,
+        usd + asset.usdValue.toDouble(),
+      );
+    }
+
+    if (raw.lastTime == null ||
+        time - raw.lastTime! >= minRawInterval.inMilliseconds) {
+      _write(raw.resolution, raw.append(time, values));
+    } else {
+      raw.pendingTime = time;
+    }
+    for (final level in _levels.skip(1)) {
+      final closed = level.accumulate(time, values);
+      if (closed != null) {
+        _write(level.resolution, closed);
+      }
+    }
+    for (final level in _levels) {
+      level.prune(time);
+    }
+    return _writes;
+  }
+
+  /// Points of [series] from [from] to [to], at the finest resolution that
+  /// covers the range in at most [maxPoints] points (else the coarsest).
+  HistoryRange query(
+    String series,
+    DateTime from,
+    DateTime to, {
+    int maxPoints = 1000,
+  }) {
+    final id = _ids[series];
+    final start = from.millisecondsSinceEpoch.toDouble();
+    final end = to.millisecondsSinceEpoch.toDouble();
+    HistoryRange? coarsest;
+    for (final level in _levels) {
+      final rows = id == null ? null : level.series[id];
+      if (rows == null || rows.length == 0) {
+        continue;
+      }
+      final first = rows.lowerBound(start);
+      final last = rows.lowerBound(end, after: true);
+      coarsest = rows.range(level.resolution, first, last);
+      final covers = !rows.pruned || rows.times[0] <= start;
+      if (covers && last - first <= maxPoints) {
+        return coarsest;
+      }
+    }
+    return coarsest ?? HistoryRange.empty(HistoryResolution.raw);
+  }
+
+  int _idOf(String name) {
+    final existing = _ids[name];
+    if (existing != null) {
+      return existing;
+    }
+    final id = _names.length;
+    _names.add(name);
+    _ids[name] = id;
+    final encoded = utf8.encode(name);
+    final entry = Uint8List(2 + encoded.length);
+    ByteData.sublistView(entry).setUint16(0, encoded.length, Endian.little);
+    entry.setAll(2, encoded);
+    _enqueue(() => _storage.append(_seriesSegment, entry));
+    return id;
+  }
+
+  void _write(HistoryResolution resolution, Uint8List block) {
+    _enqueue(() => _storage.append(resolution.name, block));
+  }
+
+  // Writes run in order; a failed write is reported once and does not block
+  // the ones after it.
+  void _enqueue(Future<void> Function() write) {
+    _writes = _writes.catchError((Object _) {}).then((_) => write());
+  }
+
+  Future<void> _load(double now) async {
+    final segments = await _storage.readAll();
+
+    final names = segments[_seriesSegment];
+    if (names != null) {
+      final data = ByteData.sublistView(names);
+      var offset = 0;
+      while (offset + 2 <= names.length) {
+        final length = data.getUint16(offset, Endian.little);
+        if (offset + 2 + length > names.length) {
+          break;
+        }
+        final name = utf8.decode(
+          Uint8List.sublistView(names, offset + 2, offset + 2 + length),
+        );
+        _ids[name] = _names.length;
+        _names.add(name);
+        offset += 2 + length;
+      }
+    }
+
+    for (final level in _levels) {
+      final bytes = segments[level.resolution.name];
+      if (bytes == null) {
+        continue;
+      }
+      final retention = level.resolution.retention;
+      final cutoff = retention == null
+          ? double.negativeInfinity
+          : now - retention.inMilliseconds;
+      final kept = BytesBuilder(copy: false);
+      var dropped = 0;
+      var total = 0;
+      _forEachBlock(bytes, (time, ids, balances, usd, block) {
+        total++;
+        if (time < cutoff) {
+          dropped++;
+          for (final id in ids) {
+            level.series.putIfAbsent(id, _Series.new).pruned = true;
+          }
+          return;
+        }
+        kept.add(block);
+        for (var i = 0; i < ids.length; i++) {
+          level.series
+              .putIfAbsent(ids[i], _Series.new)
+              .add(time, balances[i], usd[i]);
+        }
+      });
+      if (dropped > 0 && dropped * 2 >= total) {
+        final compacted = kept.takeBytes();
+        _enqueue(() => _storage.replace(level.resolution.name, compacted));
+      }
+    }
+
+    // Reopens each downsampled level's last bucket from the finer level.
+    for (var i = 1; i < _levels.length; i++) {
+      final level = _levels[i];
+      final closedUntil = level.lastTime;
+      final since = closedUntil == null
+          ? double.negativeInfinity
+          : closedUntil + level.resolution.bucket.inMilliseconds;
+      final snapshots = _levels[i - 1].snapshotsSince(since);
+      for (final time in snapshots.keys.toList()..sort()) {
+        final closed = level.accumulate(time, snapshots[time]!);
+        if (closed != null) {
+          _write(level.resolution, closed);
+        }
+      }
+    }
+    await _writes.catchError((Object _) {});
+  }
+
+  static void _forEachBlock(
+    Uint8List bytes,
+    void Function(
+      double time,
+      List<int> ids,
+      List<double> balances,
+      List<double> usd,
+      Uint8List block,
+    )
+    visit,
+  ) {
+    final data = ByteData.sublistView(bytes);
+    var offset = 0;
+    while (offset + _blockHeader <= bytes.length) {
+      final time = data.getFloat64(offset, Endian.little);
+      final rows = data.getUint16(offset + 8, Endian.little);
+      final size = _blockHeader + rows * _bytesPerRow;
+      if (offset + size > bytes.length) {
+        // A block cut short by a crash mid-append.
+        break;
+      }
+      final idsAt = offset + _blockHeader;
+      final balancesAt = idsAt + rows * 2;
+      final usdAt = balancesAt + rows * 8;
+      double f64(int at) => data.getFloat64(at, Endian.little);
+      visit(
+        time,
+        [
+          for (var i = 0; i < rows; i++)
+            data.getUint16(idsAt + i * 2, Endian.little),
+        ],
+        [for (var i = 0; i < rows; i++) f64(balancesAt + i * 8)],
+        [for (var i = 0; i < rows; i++) f64(usdAt + i * 8)],
+        Uint8List.sublistView(bytes, offset, offset + size),
+      );
+      offset += size;
+    }
+  }
+
+  static Uint8List _encodeBlock(double time, Map<int, (double, double)> rows) {
+    final count = rows.length;
+    final bytes = Uint8List(_blockHeader + count * _bytesPerRow);
+    final data = ByteData.sublistView(bytes);
+    data.setFloat64(0, time, Endian.little);
+    data.setUint16(8, count, Endian.little);
+    final balancesAt = _blockHeader + count * 2;
+    final usdAt = balancesAt + count * 8;
+    var i = 0;
+    for (final MapEntry(key: id, value: (balance, usd)) in rows.entries) {
+      data.setUint16(_blockHeader + i * 2, id, Endian.little);
+      data.setFloat64(balancesAt + i * 8, balance, Endian.little);
+      data.setFloat64(usdAt + i * 8, usd, Endian.little);
+      i++;
+    }
+    return bytes;
+  }
+}
+
+// One resolution: a series per id plus, for downsampled levels, the bucket
+// still being filled (kept as each series' last row but not yet written).
+class _Level {
+  _Level(this.resolution);
+
+  final HistoryResolution resolution;
+  final Map<int, _Series> series = {};
+  double? openBucket;
+  final Map<int, (double, double)> _open = {};
+
+  // Latest raw snapshot skipped by HistoryStore.minRawInterval.
+  double? pendingTime;
+
+  double? get lastTime {
+    double? last;
+    for (final rows in series.values) {
+      final time = rows.lastTime;
+      if (time != null && (last == null || time > last)) {
+        last = time;
+      }
+    }
+    return last;
+  }
+
+  Uint8List append(double time, Map<int, (double, double)> values) {
+    for (final MapEntry(key: id, value: (balance, usd)) in values.entries) {
+      series.putIfAbsent(id, _Series.new).add(time, balance, usd);
+    }
+    pendingTime = null;
+    return HistoryStore._encodeBlock(time, values);
+  }
+
+  /// Folds a snapshot into its bucket; returns the encoded previous bucket
+  /// when this snapshot closes it.
+  Uint8List? accumulate(double time, Map<int, (double, double)> values) {
+    final size = resolution.bucket.inMilliseconds;
+    final bucket = (time / size).floorToDouble() * size;
+    Uint8List? closed;
+    final open = openBucket;
+    if (open != null && bucket != open) {
+      closed = HistoryStore._encodeBlock(open, Map.of(_open));
+      _open.clear();
+    }
+    openBucket = bucket;
+    for (final MapEntry(key: id, value: (balance, usd)) in values.entries) {
+      final rows = series.putIfAbsent(id, _Series.new);
+      if (rows.lastTime == bucket) {
+        rows.setLast(balance, usd);
+      } else {
+        rows.add(bucket, balance, usd);
+      }
+      _open[id] = (balance, usd);
+    }
+    return closed;
+  }
+
+  /// Rows at or after [since], grouped into snapshots by time.
+  Map<double, Map<int, (double, double)>> snapshotsSince(double since) {
+    final snapshots = <double, Map<int, (double, double)>>{};
+    for (final MapEntry(key: id, value: rows) in series.entries) {
+      for (var i = rows.lowerBound(since); i < rows.length; i++) {
+        snapshots.putIfAbsent(rows.times[i], () => {})[id] = (
+          rows.balances[i],
+          rows.usd[i],
+        );
+      }
+    }
+    return snapshots;
+  }
+
+  void prune(double now) {
+    final retention = resolution.retention;
+    if (retention == null) {
+      return;
+    }
+    for (final rows in series.values) {
+      rows.dropBefore(now - retention.inMilliseconds);
+    }
+  }
+}
+
+class _Series {
+  final _Column times = _Column();
+  final _Column balances = _Column();
+  final _Column usd = _Column();
+
+  /// Whether rows were dropped for retention, so this level no longer
+  /// reaches back to the series' first snapshot.
+  bool pruned = false;
+
+  int get length => times.length;
+
+  double? get lastTime => length == 0 ? null : times[length - 1];
+
+  void add(double time, double balance, double value) {
+    times.add(time);
+    balances.add(balance);
+    usd.add(value);
+  }
+
+  void setLast(double balance, double value) {
+    balances[length - 1] = balance;
+    usd[length - 1] = value;
+  }
+
+  /// First index whose time is at or after [time] (after it when [after]).
+  int lowerBound(double time, {bool after = false}) {
+    var low = 0;
+    var high = length;
+    while (low < high) {
+      final mid = (low + high) >> 1;
+      final value = times[mid];
+      if (value < time || (after && value == time)) {
+        low = mid + 1;
+      } else {
+        high = mid;
+      }
+    }
+    return low;
+  }
+
+  HistoryRange range(HistoryResolution resolution, int from, int to) =>
+      HistoryRange(
+        resolution,
+        times.view(from, to),
+        balances.view(from, to),
+        usd.view(from, to),
+      );
+
+  // Shifts the columns only once enough rows expired, so pruning stays
+  // amortized O(1) per snapshot.
+  void dropBefore(double cutoff) {
+    final expired = lowerBound(cutoff);
+    if (expired == 0 || (expired < 256 && expired * 2 < length)) {
+      return;
+    }
+    times.dropFirst(expired);
+    balances.dropFirst(expired);
+    usd.dropFirst(expired);
+    pruned = true;
+  }
+}
+
+class _Column {
+  Float64List _data = Float64List(16);
+  int length = 0;
+
+  double operator [](int index) => _data[index];
+
+  void operator []=(int index, double value) => _data[index] = value;
+
+  void add(double value) {
+    if (length == _data.length) {
+      _data = Float64List(length * 2)..setRange(0, length, _data);
+    }
+    _data[length++] = value;
+  }
+
+  void dropFirst(int count) {
+    _data.setRange(0, length - count, _data, count);
+    length -= count;
+  }
+
+  Float64List view(int from, int to) =>
+      Float64List.sublistView(_data, from, to);
+}
@@ -0,0 +1,200 @@
+import 'dart:convert';
+import 'dart:math' as math;
+
+import 'package:http/http.dart' as http;
+
+/// One call in a [JsonRpcClient.batch].
+class JsonRpcRequest {
+  const JsonRpcRequest(this.method, this.params);
+
+  /// `eth_getBalance` of [address] at [block], or the latest block.
+  JsonRpcRequest.getBalance(String address, {int? block})
+    : this('eth_getBalance', [address, _blockTag(block)]);
+
+  /// ERC-20 `balanceOf(owner)` on [token] via `eth_call`.
+  JsonRpcRequest.balanceOf(String token, String owner)
+    : this('eth_call', [
+        {'to': token, 'data': _balanceOfSelector + _encodeAddress(owner)},
+        'latest',
+      ]);
+
+  /// `eth_blockNumber`.
+  const JsonRpcRequest.blockNumber() : this('eth_blockNumber', const []);
+
+  /// `eth_getLogs` from [fromBlock] to [toBlock] inclusive, filtered by
+  /// [topics] (null matches any value in that position).
+  JsonRpcRequest.getLogs({
+    required int fromBlock,
+    required int toBlock,
+    required List<String?> topics,
+  }) : this('eth_getLogs', [
+         {
+           'fromBlock': _blockTag(fromBlock),
+           'toBlock': _blockTag(toBlock),
+           'topics': topics,
+         },
+       ]);
+
+  /// topic0 of ERC-20 `Transfer(address,address,uint256)`.
+  static const String transferTopic =
+      '0xddf252ad1be2c89b69c2b068fc378daa952ba7f163c4a11628f55a4df523b3ef';
+
+  /// [address] as an indexed event topic.
+  static String addressTopic(String address) => '0x${_encodeAddress(address)}';
+
+  static const String _balanceOfSelector = '0x70a08231';
+
+  final String method;
+  final List<Object?> params;
+
+  static String _blockTag(int? block) =>
+      block == null ? 'latest' : '0x${block.toRadixString(16)}';
+
+  static String _encodeAddress(String address) {
+    final hex = address.toLowerCase().startsWith('0x')
+        ? address.substring(2)
+        : address;
+    return hex.toLowerCase().padLeft(64, '0');
+  }
+}
+
+class JsonRpcException implements Exception {
+  const JsonRpcException(this.message, {this.code});
+
+  final String message;
+  final int? code;
+
+  @override
+  String toString() =>
+      'JsonRpcException(${code == null ? '' : '$code: '}$message)';
+}
+
+/// Minimal read-only Ethereum JSON-RPC client over HTTP. Calls are sent as
+/// one batch per [batch] so a whole chain is read in a single round trip.
+class JsonRpcClient {
+  JsonRpcClient(
+    this.endpoint, {
+    http.Client? httpClient,
+    this.maxBatchSize = 100,
+  }) : _httpClient = httpClient ?? http.Client(),
+       _ownsClient = httpClient == null;
+
+  final Uri endpoint;
+
+  /// Most calls sent in one HTTP request. Public nodes reject or truncate
+  /// larger batches, so longer lists go out as several parallel requests.
+  final int maxBatchSize;
+
+  final http.Client _httpClient;
+  final bool _ownsClient;
+  int _nextId = 1;
+
+  /// Results in request order. A call that failed on its own is returned as
+  /// a [JsonRpcException] in its slot; transport errors throw.
+  Future<List<Object?>> batch(List<JsonRpcRequest> requests) async {
+    if (requests.isEmpty) {
+      return const [];
+    }
+    if (requests.length <= maxBatchSize) {
+      return _send(requests);
+    }
+
+    final chunks = await Future.wait([
+      for (var start = 0; start < requests.length; start += maxBatchSize)
+        _send(
+          requests.sublist(
+            start,
+            math.min(start + maxBatchSize, requests.length),
+          ),
+        ),
+    ]);
+    return [for (final chunk in chunks) ...chunk];
+  }
+
+  Future<List<Object?>> _send(List<JsonRpcRequest> requests) async {
+    final firstId = _nextId;
+    _nextId += requests.length;
+    final body = jsonEncode([
+      for (var i = 0; i < requests.length; i++)
+        {
+          'jsonrpc': '2.0',
+          'id': firstId + i,
+          'method': requests[i].method,
+          'params': requests[i].params,
+        },
+    ]);
+
+    final response = await _httpClient.post(
+      endpoint,
+      headers: const {'content-type': 'application/json'},
+      body: body,
+    );
+    if (response.statusCode != 200) {
+      throw JsonRpcException(
+        'HTTP ${response.statusCode} from $endpoint',
+        code: response.statusCode,
+      );
+    }
+
+    final decoded = jsonDecode(response.body);
+    // Some nodes answer a batch with a single error object.
+    if (decoded is Map) {
+      throw _errorOf(decoded) ??
+          const JsonRpcException('Unexpected non-batch response');
+    }
+
+    final results = List<Object?>.filled(
+      requests.length,
+      const JsonRpcException('Missing response'),
+    );
+    for (final entry in decoded as List) {
+      if (entry is! Map) {
+        continue;
+      }
+      final id = entry['id'];
+      if (id is! int || id < firstId || id >= firstId + requests.length) {
+        continue;
+      }
+      results[id - firstId] = _errorOf(entry) ?? entry['result'];
+    }
+    return results;
+  }
+
+  void dispose() {
+    if (_ownsClient) {
+      _httpClient.close();
+    }
+  }
+
+  /// Parses a hex quantity or 32-byte word (`0x`, `0x0`, `0x1bc16d...`);
+  /// anything else throws a [JsonRpcException] like a failed call.
+  static BigInt parseQuantity(Object? value) {
+    if (value is! String || !value.startsWith('0x')) {
+      throw JsonRpcException('Not a hex quantity: $value');
+    }
+    final hex = value.substring(2);
+    if (hex.isEmpty) {
+      return BigInt.zero;
+    }
+    // tryParse also accepts a sign, which a quantity never has.
+    final parsed = hex.startsWith(RegExp('[+-]'))
+        ? null
+        : BigInt.tryParse(hex, radix: 16);
+    if (parsed == null) {
+      throw JsonRpcException('Not a hex quantity: $value');
+    }
+    return parsed;
+  }
+
+  static JsonRpcException? _errorOf(Map<dynamic, dynamic> entry) {
+    final error = entry['error'];
+    if (error is! Map) {
+      return null;
+    }
+    final code = error['code'];
+    return JsonRpcException(
+      error['message']?.toString() ?? 'RPC error',
+      code: code is int ? code : null,
+    );
+  }
+}
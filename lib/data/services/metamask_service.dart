@@ -1,69 +1,39 @@
 import 'dart:async';
-import 'dart:convert';
+import 'dart:math' as math;
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter_web3/flutter_web3.dart';
 import 'package:js/js_util.dart' as js_util;
-import 'package:http/http.dart' as http;
 
+import 'package:crypto_treasury/data/models/chain_config.dart';
 import 'package:crypto_treasury/data/models/crypto_asset.dart';
 import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
 import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
 
 class MetamaskService {
-  MetamaskService({http.Client? httpClient})
-      : _httpClient = httpClient ?? http.Client(),
-        _ownsClient = httpClient == null {
+  MetamaskService({PriceService? priceService})
+      : _prices = priceService ?? PriceService(),
+        _ownsPrices = priceService == null {
     _warmUpCachedState();
   }
 
-  final http.Client _httpClient;
-  final bool _ownsClient;
+  final PriceService _prices;
+  final bool _ownsPrices;
 
   static const _erc20Abi = [
     'function balanceOf(address owner) view returns (uint256)',
   ];
 
-  static const Map<int, String> _chainNames = {
-    1: 'Ethereum',
-    5: 'Goerli',
-    11155111: 'Sepolia',
-    137: 'Polygon',
-    56: 'BNB Smart Chain',
-  };
-
-  static const Map<int, String> _nativeSymbols = {
-    1: 'ETH',
-    5: 'ETH',
-    11155111: 'ETH',
-    137: 'MATIC',
-    56: 'BNB',
-  };
-
-  static const Map<int, String> _nativeCoingeckoIds = {
-    1: 'ethereum',
-    5: 'ethereum',
-    11155111: 'ethereum',
-    137: 'matic-network',
-    56: 'binancecoin',
-  };
-
-  static const Map<int, String> _coingeckoPlatforms = {
-    1: 'ethereum',
-    137: 'polygon-pos',
-    56: 'binance-smart-chain',
-  };
-
-  static const Set<String> _stableCoinSymbols = {
-    'USDC',
-    'USDC.E',
-    'USDCe',
-    'USDT',
-    'DAI',
-    'BUSD',
-    'USDP',
-    'TUSD',
-  };
+  // Token balances read at once through the injected provider; MetaMask
+  // rate-limits its RPC, so large registries are read a few at a time.
+  static const int _maxConcurrentTokenReads = 8;
+
+  // Balances that answer within this window go out as one wallet, so a
+  // large registry yields a few emissions rather than one copy per token.
+  static const Duration _emitInterval = Duration(milliseconds: 100);
 
   Ethereum? get _ethereum => ethereum;
 
@@ -285,113 +255,187 @@ class MetamaskService {
     return primary;
   }
 
-  Future<CryptoWallet?> connectAndLoadWallet({
-    required List<TrackedToken> trackedTokens,
-  }) async {
+  /// Connects, then streams the wallet for the connected account as it loads
+  /// (see [watchWallet]). Emits nothing when no account or chain is available.
+  Stream<CryptoWallet> connectAndWatchWallet({
+    required TokenRegistry tokenRegistry,
+  }) async* {
     final address = await connect();
     if (address == null) {
-      debugPrint('[MetaMask] connectAndLoadWallet() no account returned');
-      return null;
+      debugPrint('[MetaMask] connectAndWatchWallet() no account returned');
+      return;
     }
 
     final chainId = await _resolveChainId();
     if (chainId == null) {
-      debugPrint('[MetaMask] connectAndLoadWallet() failed to resolve chainId');
-      return null;
+      debugPrint('[MetaMask] connectAndWatchWallet() failed to resolve chainId');
+      return;
     }
 
-    debugPrint('[MetaMask] connectAndLoadWallet() chainId=' + chainId.toString());
-    final assets = await _buildAssets(
+    debugPrint('[MetaMask] connectAndWatchWallet() chainId=' + chainId.toString());
+    yield* watchWallet(
       address: address,
       chainId: chainId,
-      trackedTokens: trackedTokens,
+      tokenRegistry: tokenRegistry,
     );
-
-    return CryptoWallet(address: address, chainId: chainId, assets: assets);
   }
 
-  Future<CryptoWallet?> loadWallet({
+  /// Streams progressively more complete wallets: the native balance first,
+  /// then each token as its balance resolves, then the same assets revalued
+  /// once prices arrive. Every emission is a complete [CryptoWallet] whose
+  /// asset list extends the previous one, so earlier positions never move.
+  ///
+  /// All balance and price requests are issued at once. Tokens that fail to
+  /// read are skipped; a failed native balance read is reported as an error.
+  Stream<CryptoWallet> watchWallet({
     required String address,
     required int chainId,
-    required List<TrackedToken> trackedTokens,
-  }) async {
+    required TokenRegistry tokenRegistry,
+  }) {
     if (!isMetaMask) {
-      debugPrint('[MetaMask] loadWallet() aborted: MetaMask unavailable');
-      return null;
+      debugPrint('[MetaMask] watchWallet() aborted: MetaMask unavailable');
+      return const Stream<CryptoWallet>.empty();
     }
 
-    debugPrint('[MetaMask] loadWallet() using cached address=' + address + ', chainId=' + chainId.toString());
+    debugPrint('[MetaMask] watchWallet() address=' + address + ', chainId=' + chainId.toString());
     _cachedAccount = address;
     _cachedChainId = chainId;
-    final assets = await _buildAssets(
+    return _streamAssets(
       address: address,
       chainId: chainId,
-      trackedTokens: trackedTokens,
+      tokenRegistry: tokenRegistry,
+    ).map(
+      (assets) => CryptoWallet(address: address, chainId: chainId, assets: assets),
     );
-
-    return CryptoWallet(address: address, chainId: chainId, assets: assets);
   }
 
-  Future<List<CryptoAsset>> _buildAssets({
+  Stream<List<CryptoAsset>> _streamAssets({
     required String address,
     required int chainId,
-    required List<TrackedToken> trackedTokens,
-  }) async {
+    required TokenRegistry tokenRegistry,
+  }) {
     final provider = _provider;
     if (provider == null) {
-      return const <CryptoAsset>[];
+      return Stream.value(const <CryptoAsset>[]);
     }
 
+    final filteredTokens = tokenRegistry.tokensOn(chainId);
+    final controller = StreamController<List<CryptoAsset>>();
     final assets = <CryptoAsset>[];
+    // Token backing each entry of [assets]; null for the native asset.
+    final sources = <TrackedToken?>[];
+    double? nativePrice;
+    Map<String, double>? tokenPrices;
+
+    double priceOf(TrackedToken? token) => token == null
+        ? nativePrice ?? 0
+        : PriceService.resolveUsdPrice(token, tokenPrices ?? const {});
+
+    Timer? pendingEmit;
+    void emit() {
+      pendingEmit?.cancel();
+      pendingEmit = null;
+      if (!controller.isClosed) {
+        controller.add(List.unmodifiable(assets));
+      }
+    }
 
-    final nativeSymbol = _nativeSymbols[chainId] ?? 'NATIVE';
-    final nativeName = '${_chainNames[chainId] ?? 'Unknown'} Native';
-    final nativeBalance = await provider.getBalance(address);
-    final nativePrice = await _fetchNativeUsdPrice(chainId) ?? 0;
-    final nativeUsdValue = _normalize(nativeBalance, 18) * nativePrice;
-
-    assets.add(
-      CryptoAsset(
-        symbol: nativeSymbol,
-        name: nativeName,
-        balance: nativeBalance,
-        decimals: 18,
-        logoUrl: null,
-        usdValue: nativeUsdValue,
-      ),
-    );
-
-    final filteredTokens =
-        trackedTokens.where((token) => token.chainId == chainId).toList();
-    if (filteredTokens.isEmpty) {
-      return assets;
+    void emitSoon() {
+      pendingEmit ??= Timer(_emitInterval, emit);
     }
 
-    final usdPrices = await _fetchTokenUsdPrices(chainId, filteredTokens);
+    void add(TrackedToken? token, CryptoAsset asset) {
+      assets.add(
+        asset.copyWith(usdValue: CryptoAsset.valueAt(asset.amount, priceOf(token))),
+      );
+      sources.add(token);
+      emitSoon();
+    }
+
+    final native = provider.getBalance(address).then((balance) {
+      add(
+        null,
+        CryptoAsset(
+          symbol: ChainConfig.nativeSymbolOf(chainId),
+          name: ChainConfig.nativeNameOf(chainId),
+          amount: FixedDecimal(balance, 18),
+          logoUrl: null,
+          usdValue: FixedDecimal.zero,
+        ),
+      );
+    });
 
-    for (final token in filteredTokens) {
-      try {
-        final balance = await _readTokenBalance(token, address);
-        final normalized = _normalize(balance, token.decimals);
-        final price = _resolveUsdPrice(token, usdPrices);
-        final usdValue = normalized * price;
+    var nextToken = 0;
+    Future<void> readTokens() async {
+      while (nextToken < filteredTokens.length) {
+        final token = filteredTokens[nextToken++];
+        final BigInt balance;
+        try {
+          balance = await _readTokenBalance(token, address);
+        } catch (_) {
+          // Skip tokens we fail to read to keep UX resilient.
+          continue;
+        }
+        if (balance == BigInt.zero) {
+          continue;
+        }
 
-        assets.add(
+        // Keeps the native asset first even when a token answers sooner.
+        await native;
+        add(
+          token,
           CryptoAsset(
             symbol: token.symbol,
             name: token.name,
-            balance: balance,
-            decimals: token.decimals,
+            amount: FixedDecimal(balance, token.decimals),
             logoUrl: token.logoUrl,
-            usdValue: usdValue,
+            usdValue: FixedDecimal.zero,
           ),
         );
-      } catch (_) {
-        // Skip tokens we fail to read to keep UX resilient.
       }
     }
 
-    return assets;
+    final tokens = [
+      for (
+        var i = 0;
+        i < math.min(_maxConcurrentTokenReads, filteredTokens.length);
+        i++
+      )
+        readTokens(),
+    ];
+
+    final prices = Future.wait([
+      _prices.fetchNativeUsdPrice(chainId).then((price) => nativePrice = price),
+      _prices.fetchTokenUsdPrices(
+        chainId,
+        filteredTokens,
+      ).then((values) => tokenPrices = values),
+    ]).then((_) async {
+      await native;
+      for (var i = 0; i < assets.length; i++) {
+        assets[i] = assets[i].copyWith(
+          usdValue: CryptoAsset.valueAt(assets[i].amount, priceOf(sources[i])),
+        );
+      }
+      emitSoon();
+    });
+
+    Future.wait([native, prices, ...tokens]).then(
+      (_) {
+        if (pendingEmit != null) {
+          emit();
+        }
+        controller.close();
+      },
+      onError: (Object error, StackTrace stack) {
+        pendingEmit?.cancel();
+        if (!controller.isClosed) {
+          controller.addError(error, stack);
+          controller.close();
+        }
+      },
+    );
+    return controller.stream;
   }
 
   Web3Provider? get _provider {
@@ -412,105 +456,9 @@ class MetamaskService {
     return value;
   }
 
-  double _normalize(BigInt value, int decimals) {
-    if (decimals <= 0) {
-      return value.toDouble();
-    }
-
-    final divisor = BigInt.from(10).pow(decimals);
-    if (divisor == BigInt.zero) {
-      return 0;
-    }
-
-    return value.toDouble() / divisor.toDouble();
-  }
-
-  double _resolveUsdPrice(TrackedToken token, Map<String, double> usdPrices) {
-    final addressKey = token.address.toLowerCase();
-    final marketPrice = usdPrices[addressKey];
-    if (marketPrice != null && marketPrice > 0) {
-      return marketPrice;
-    }
-
-    final symbol = token.symbol.toUpperCase();
-    if (_stableCoinSymbols.contains(symbol)) {
-      return 1;
-    }
-
-    return 0;
-  }
-
-  Future<double?> _fetchNativeUsdPrice(int chainId) async {
-    final id = _nativeCoingeckoIds[chainId];
-    if (id == null) {
-      return null;
-    }
-
-    try {
-      final uri = Uri.https('api.coingecko.com', '/api/v3/simple/price', {
-        'ids': id,
-        'vs_currencies': 'usd',
-      });
-      final response = await _httpClient.get(uri);
-      if (response.statusCode != 200) {
-        return null;
-      }
-      final payload = jsonDecode(response.body) as Map<String, dynamic>;
-      final data = payload[id] as Map<String, dynamic>?;
-      final price = data?['usd'];
-      if (price is num) {
-        return price.toDouble();
-      }
-    } catch (_) {
-      return null;
-    }
-    return null;
-  }
-
-  Future<Map<String, double>> _fetchTokenUsdPrices(
-    int chainId,
-    List<TrackedToken> tokens,
-  ) async {
-    final platform = _coingeckoPlatforms[chainId];
-    if (platform == null) {
-      return <String, double>{};
-    }
-
-    final contractAddresses = tokens
-        .where((token) => token.coingeckoId != null)
-        .map((token) => token.address.toLowerCase())
-        .toList();
-
-    if (contractAddresses.isEmpty) {
-      return <String, double>{};
-    }
-
-    try {
-      final uri = Uri.https(
-        'api.coingecko.com',
-        '/api/v3/simple/token_price/$platform',
-        {
-          'contract_addresses': contractAddresses.join(','),
-          'vs_currencies': 'usd',
-        },
-      );
-      final response = await _httpClient.get(uri);
-      if (response.statusCode != 200) {
-        return <String, double>{};
-      }
-      final decoded = jsonDecode(response.body) as Map<String, dynamic>;
-      return decoded.map((key, value) {
-        final price = (value as Map<String, dynamic>)['usd'];
-        return MapEntry(key.toLowerCase(), price is num ? price.toDouble() : 0);
-      });
-    } catch (_) {
-      return <String, double>{};
-    }
-  }
-
   void dispose() {
-    if (_ownsClient) {
-      _httpClient.close();
+    if (_ownsPrices) {
+      _prices.dispose();
     }
 
     final eth = _ethereum;
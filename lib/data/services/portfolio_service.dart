@@ -0,0 +1,249 @@
+import 'dart:async';
+
+import 'package:http/http.dart' as http;
+
+import 'package:crypto_treasury/data/models/chain_breakdown.dart';
+import 'package:crypto_treasury/data/models/chain_config.dart';
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/json_rpc_client.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+// Reads one address on every configured chain in parallel through public
+// JSON-RPC endpoints, without MetaMask, and merges the result into a single
+// multi-chain CryptoWallet.
+class PortfolioService {
+  PortfolioService({
+    Map<int, Uri>? endpoints,
+    http.Client? httpClient,
+    PriceService? priceService,
+    this.timeout = const Duration(seconds: 10),
+  }) : _httpClient = httpClient ?? http.Client(),
+       _ownsClient = httpClient == null,
+       _prices = priceService ?? PriceService(httpClient: httpClient),
+       _ownsPrices = priceService == null {
+    final configured = endpoints ?? ChainConfig.defaultRpcEndpoints;
+    _clients = {
+      for (final entry in configured.entries)
+        entry.key: JsonRpcClient(entry.value, httpClient: _httpClient),
+    };
+  }
+
+  final http.Client _httpClient;
+  final bool _ownsClient;
+  final PriceService _prices;
+  final bool _ownsPrices;
+  final Duration timeout;
+  late final Map<int, JsonRpcClient> _clients;
+
+  Iterable<int> get chainIds => _clients.keys;
+
+  /// Client for [chainId]'s endpoint, shared with other readers of the chain.
+  JsonRpcClient? clientFor(int chainId) => _clients[chainId];
+
+  /// Streams the merged wallet as chains answer: each chain's balances are
+  /// appended in one step (one batched RPC round trip per chain), and its
+  /// assets are revalued once its prices arrive. Assets keep their position
+  /// across emissions.
+  ///
+  /// Tokens with a zero balance are left out; the native asset of each chain
+  /// that answered is always included. A chain that fails is reported in
+  /// [CryptoWallet.chains]; the stream only errors when every chain fails.
+  Stream<CryptoWallet> watchPortfolio({
+    required String address,
+    required TokenRegistry tokenRegistry,
+  }) {
+    final controller = StreamController<CryptoWallet>();
+    final assets = <CryptoAsset>[];
+    // Token behind each entry of [assets]; null for native assets.
+    final sources = <TrackedToken?>[];
+    final chains = <ChainBreakdown>[];
+    var failures = 0;
+
+    void emit() {
+      if (controller.isClosed) {
+        return;
+      }
+      controller.add(
+        CryptoWallet(
+          address: address,
+          chainId: CryptoWallet.allChains,
+          assets: List.unmodifiable(assets),
+          chains: List.unmodifiable(chains),
+        ),
+      );
+    }
+
+    FixedDecimal totalFor(int chainId) => assets
+        .where((asset) => asset.chainId == chainId)
+        .fold(FixedDecimal.zero, (total, asset) => total + asset.usdValue);
+
+    Future<void> readChain(int chainId, JsonRpcClient client) async {
+      final tokens = tokenRegistry.tokensOn(chainId);
+      final started = Stopwatch()..start();
+      final prices = _fetchPrices(chainId, tokens);
+
+      final List<Object?> results;
+      final BigInt native;
+      try {
+        results = await client
+            .batch([
+              JsonRpcRequest.getBalance(address),
+              for (final token in tokens)
+                JsonRpcRequest.balanceOf(token.address, address),
+            ])
+            .timeout(timeout);
+        if (results.first is JsonRpcException) {
+          throw results.first!;
+        }
+        native = JsonRpcClient.parseQuantity(results.first);
+      } catch (error) {
+        failures++;
+        chains.add(
+          ChainBreakdown(
+            chainId: chainId,
+            name: ChainConfig.nameOf(chainId),
+            assetCount: 0,
+            usdValue: FixedDecimal.zero,
+            rpcLatency: started.elapsed,
+            error: error.toString(),
+          ),
+        );
+        emit();
+        return;
+      }
+      final rpcLatency = started.elapsed;
+
+      final known = prices.value;
+      final first = assets.length;
+      void add(TrackedToken? token, CryptoAsset asset) {
+        final price = token == null
+            ? known?.native ?? 0
+            : PriceService.resolveUsdPrice(token, known?.tokens ?? const {});
+        assets.add(
+          asset.copyWith(usdValue: CryptoAsset.valueAt(asset.amount, price)),
+        );
+        sources.add(token);
+      }
+
+      add(
+        null,
+        CryptoAsset(
+          symbol: ChainConfig.nativeSymbolOf(chainId),
+          name: ChainConfig.nativeNameOf(chainId),
+          amount: FixedDecimal(native, 18),
+          logoUrl: null,
+          usdValue: FixedDecimal.zero,
+          chainId: chainId,
+        ),
+      );
+      for (var i = 0; i < tokens.length; i++) {
+        final BigInt balance;
+        try {
+          balance = JsonRpcClient.parseQuantity(results[i + 1]);
+        } on JsonRpcException {
+          // Skip tokens we fail to read to keep UX resilient.
+          continue;
+        }
+        if (balance == BigInt.zero) {
+          continue;
+        }
+        final token = tokens[i];
+        add(
+          token,
+          CryptoAsset(
+            symbol: token.symbol,
+            name: token.name,
+            amount: FixedDecimal(balance, token.decimals),
+            logoUrl: token.logoUrl,
+            usdValue: FixedDecimal.zero,
+            chainId: chainId,
+          ),
+        );
+      }
+
+      final breakdown = ChainBreakdown(
+        chainId: chainId,
+        name: ChainConfig.nameOf(chainId),
+        assetCount: assets.length - first,
+        usdValue: totalFor(chainId),
+        rpcLatency: rpcLatency,
+        priceLatency: known == null ? null : started.elapsed,
+      );
+      final slot = chains.length;
+      chains.add(breakdown);
+      emit();
+
+      if (known != null) {
+        return;
+      }
+      final fetched = await prices.future;
+      for (var i = first; i < first + breakdown.assetCount; i++) {
+        final token = sources[i];
+        final price = token == null
+            ? fetched.native ?? 0
+            : PriceService.resolveUsdPrice(token, fetched.tokens);
+        assets[i] = assets[i].copyWith(
+          usdValue: CryptoAsset.valueAt(assets[i].amount, price),
+        );
+      }
+      chains[slot] = breakdown.copyWith(
+        usdValue: totalFor(chainId),
+        priceLatency: started.elapsed,
+      );
+      emit();
+    }
+
+    Future.wait([
+      for (final entry in _clients.entries) readChain(entry.key, entry.value),
+    ]).whenComplete(() {
+      if (_clients.isNotEmpty && failures == _clients.length) {
+        controller.addError(
+          StateError('No chain could be read: ${chains.map((c) => c.error).join('; ')}'),
+        );
+      }
+      controller.close();
+    });
+    return controller.stream;
+  }
+
+  _PendingPrices _fetchPrices(int chainId, List<TrackedToken> tokens) {
+    final pending = _PendingPrices();
+    pending.future = Future.wait([
+      _prices.fetchNativeUsdPrice(chainId),
+      _prices.fetchTokenUsdPrices(chainId, tokens),
+    ]).then((values) {
+      final prices = (
+        native: values[0] as double?,
+        tokens: values[1] as Map<String, double>,
+      );
+      pending.value = prices;
+      return prices;
+    });
+    return pending;
+  }
+
+  void dispose() {
+    if (_ownsPrices) {
+      _prices.dispose();
+    }
+    for (final client in _clients.values) {
+      client.dispose();
+    }
+    if (_ownsClient) {
+      _httpClient.close();
+    }
+  }
+}
+
+typedef _ChainPrices = ({double? native, Map<String, double> tokens});
+
+// Price lookup for one chain that may already have completed by the time its
+// balances arrive.
+class _PendingPrices {
+  late final Future<_ChainPrices> future;
+  _ChainPrices? value;
+}
@@ -0,0 +1,213 @@
+import 'dart:async';
+import 'dart:convert';
+
+import 'package:flutter/foundation.dart';
+
+import 'package:crypto_treasury/data/services/price_service.dart';
+import 'package:crypto_treasury/data/services/price_socket.dart' as platform;
+
+/// A text WebSocket as used by [PriceFeed]; see `price_socket.dart`.
+class PriceSocket {
+  const PriceSocket({
+    required this.messages,
+    required this.send,
+    required this.close,
+  });
+
+  final Stream<String> messages;
+  final void Function(String message) send;
+  final Future<void> Function() close;
+}
+
+typedef PriceSocketConnector = Future<PriceSocket> Function(Uri uri);
+
+/// Live USD prices keyed by asset symbol.
+///
+/// Keeps one WebSocket to [streamUri]. On connect it sends
+/// `{"type":"subscribe","symbols":["ETH",...]}` and then accepts either
+/// `{"prices":{"ETH":2001.5}}` or `{"symbol":"ETH","usd":2001.5}`. While the
+/// socket is down, or when [streamUri] is null, prices are polled from
+/// CoinGecko every [pollInterval], and the socket is retried with a backoff
+/// starting at [reconnectDelay].
+class PriceFeed {
+  PriceFeed({
+    this.streamUri,
+    PriceService? priceService,
+    this.pollInterval = const Duration(seconds: 30),
+    this.reconnectDelay = const Duration(seconds: 2),
+    PriceSocketConnector? connect,
+  }) : _prices = priceService ?? PriceService(),
+       _ownsPrices = priceService == null,
+       _connect = connect ?? platform.connectPriceSocket;
+
+  final Uri? streamUri;
+  final Duration pollInterval;
+  final Duration reconnectDelay;
+  final PriceService _prices;
+  final bool _ownsPrices;
+  final PriceSocketConnector _connect;
+
+  static const Duration _maxReconnectDelay = Duration(minutes: 1);
+
+  /// Emits the prices that changed, for the symbols in [coingeckoIds]. Each
+  /// symbol's CoinGecko id is only used while polling; symbols without one
+  /// are updated by the socket alone.
+  Stream<Map<String, double>> watch(Map<String, String?> coingeckoIds) {
+    late final _FeedSession session;
+    final controller = StreamController<Map<String, double>>(
+      onListen: () => session.start(),
+      onCancel: () => session.stop(),
+    );
+    session = _FeedSession(this, Map.unmodifiable(coingeckoIds), controller);
+    return controller.stream;
+  }
+
+  void dispose() {
+    if (_ownsPrices) {
+      _prices.dispose();
+    }
+  }
+}
+
+class _FeedSession {
+  _FeedSession(this.feed, this.coingeckoIds, this.output)
+    : _retryDelay = feed.reconnectDelay;
+
+  final PriceFeed feed;
+  final Map<String, String?> coingeckoIds;
+  final StreamController<Map<String, double>> output;
+
+  final Map<String, double> _latest = {};
+  PriceSocket? _socket;
+  StreamSubscription<String>? _messages;
+  Timer? _pollTimer;
+  Timer? _retryTimer;
+  Duration _retryDelay;
+  bool _stopped = false;
+
+  void start() => _open();
+
+  Future<void> stop() async {
+    _stopped = true;
+    _pollTimer?.cancel();
+    _retryTimer?.cancel();
+    await _messages?.cancel();
+    await _socket?.close();
+  }
+
+  Future<void> _open() async {
+    final uri = feed.streamUri;
+    if (uri == null) {
+      _startPolling();
+      return;
+    }
+
+    try {
+      final socket = await feed._connect(uri);
+      if (_stopped) {
+        await socket.close();
+        return;
+      }
+      _socket = socket;
+      _messages = socket.messages.listen(
+        _handleMessage,
+        onError: (Object error) => _dropSocket(error),
+        onDone: () => _dropSocket('closed'),
+        cancelOnError: true,
+      );
+      socket.send(
+        jsonEncode({'type': 'subscribe', 'symbols': coingeckoIds.keys.toList()}),
+      );
+      _retryDelay = feed.reconnectDelay;
+      _pollTimer?.cancel();
+      _pollTimer = null;
+    } catch (error) {
+      _dropSocket(error);
+    }
+  }
+
+  // Polls until the socket is back.
+  void _dropSocket(Object reason) {
+    _socket = null;
+    _messages = null;
+    if (_stopped) {
+      return;
+    }
+    debugPrint('[PriceFeed] stream unavailable ($reason); polling');
+    _startPolling();
+    _retryTimer?.cancel();
+    _retryTimer = Timer(_retryDelay, _open);
+    final doubled = _retryDelay * 2;
+    _retryDelay = doubled > PriceFeed._maxReconnectDelay
+        ? PriceFeed._maxReconnectDelay
+        : doubled;
+  }
+
+  void _handleMessage(String message) {
+    final Object? decoded;
+    try {
+      decoded = jsonDecode(message);
+    } on FormatException {
+      return;
+    }
+    if (decoded is! Map) {
+      return;
+    }
+
+    final prices = decoded['prices'];
+    final symbol = decoded['symbol'];
+    final usd = decoded['usd'];
+    _publish({
+      if (prices is Map)
+        for (final entry in prices.entries)
+          if (entry.key is String && entry.value is num)
+            entry.key as String: (entry.value as num).toDouble(),
+      if (symbol is String && usd is num) symbol: usd.toDouble(),
+    });
+  }
+
+  void _startPolling() {
+    if (_pollTimer != null || _stopped) {
+      return;
+    }
+    // Several symbols can share an id, e.g. USDC and bridged USDC.e.
+    final symbolsById = <String, List<String>>{};
+    for (final MapEntry(key: symbol, value: id) in coingeckoIds.entries) {
+      if (id != null) {
+        symbolsById.putIfAbsent(id, () => []).add(symbol);
+      }
+    }
+    if (symbolsById.isEmpty) {
+      return;
+    }
+    Future<void> poll() async {
+      final prices = await feed._prices.fetchUsdPrices(symbolsById.keys);
+      if (_socket == null) {
+        _publish({
+          for (final MapEntry(key: id, value: price) in prices.entries)
+            for (final symbol in symbolsById[id] ?? const <String>[])
+              symbol: price,
+        });
+      }
+    }
+
+    _pollTimer = Timer.periodic(feed.pollInterval, (_) => poll());
+    poll();
+  }
+
+  // Forwards prices of subscribed symbols that differ from the last sent.
+  void _publish(Map<String, double> prices) {
+    final changed = <String, double>{};
+    for (final MapEntry(key: symbol, value: price) in prices.entries) {
+      if (price > 0 &&
+          coingeckoIds.containsKey(symbol) &&
+          _latest[symbol] != price) {
+        _latest[symbol] = price;
+        changed[symbol] = price;
+      }
+    }
+    if (changed.isNotEmpty && !_stopped) {
+      output.add(changed);
+    }
+  }
+}
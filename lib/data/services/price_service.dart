@@ -0,0 +1,173 @@
+import 'dart:convert';
+import 'dart:math' as math;
+
+import 'package:http/http.dart' as http;
+
+import 'package:crypto_treasury/data/models/chain_config.dart';
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+
+// USD prices from the CoinGecko simple price API. Failures resolve to no
+// price rather than throwing so balances still show.
+class PriceService {
+  PriceService({http.Client? httpClient, this.host = 'api.coingecko.com'})
+    : _httpClient = httpClient ?? http.Client(),
+      _ownsClient = httpClient == null;
+
+  final http.Client _httpClient;
+  final bool _ownsClient;
+  final String host;
+
+  /// Most ids or contract addresses put in one query string; longer lists
+  /// are split into parallel requests to stay under URL length limits.
+  static const int maxIdsPerRequest = 100;
+
+  static const Set<String> _stableCoinSymbols = {
+    'USDC',
+    'USDC.E',
+    'USDCe',
+    'USDT',
+    'DAI',
+    'BUSD',
+    'USDP',
+    'TUSD',
+  };
+
+  /// Market price from [usdPrices] (keyed by lowercase address), else 1 for
+  /// known stablecoins, else 0.
+  static double resolveUsdPrice(
+    TrackedToken token,
+    Map<String, double> usdPrices,
+  ) {
+    final addressKey = token.address.toLowerCase();
+    final marketPrice = usdPrices[addressKey];
+    if (marketPrice != null && marketPrice > 0) {
+      return marketPrice;
+    }
+
+    final symbol = token.symbol.toUpperCase();
+    if (_stableCoinSymbols.contains(symbol)) {
+      return 1;
+    }
+
+    return 0;
+  }
+
+  Future<double?> fetchNativeUsdPrice(int chainId) async {
+    final id = ChainConfig.known[chainId]?.nativeCoingeckoId;
+    if (id == null) {
+      return null;
+    }
+
+    try {
+      final uri = Uri.https(host, '/api/v3/simple/price', {
+        'ids': id,
+        'vs_currencies': 'usd',
+      });
+      final response = await _httpClient.get(uri);
+      if (response.statusCode != 200) {
+        return null;
+      }
+      final payload = jsonDecode(response.body) as Map<String, dynamic>;
+      final data = payload[id] as Map<String, dynamic>?;
+      final price = data?['usd'];
+      if (price is num) {
+        return price.toDouble();
+      }
+    } catch (_) {
+      return null;
+    }
+    return null;
+  }
+
+  /// USD prices of CoinGecko [ids], keyed by id; ids without a price are
+  /// missing.
+  Future<Map<String, double>> fetchUsdPrices(Iterable<String> ids) =>
+      _inChunks(ids.toSet().toList(), _fetchUsdPrices);
+
+  Future<Map<String, double>> _fetchUsdPrices(List<String> ids) async {
+    try {
+      final uri = Uri.https(host, '/api/v3/simple/price', {
+        'ids': ids.join(','),
+        'vs_currencies': 'usd',
+      });
+      final response = await _httpClient.get(uri);
+      if (response.statusCode != 200) {
+        return <String, double>{};
+      }
+      final payload = jsonDecode(response.body) as Map<String, dynamic>;
+      return {
+        for (final entry in payload.entries)
+          if (entry.value is Map && (entry.value as Map)['usd'] is num)
+            entry.key: ((entry.value as Map)['usd'] as num).toDouble(),
+      };
+    } catch (_) {
+      return <String, double>{};
+    }
+  }
+
+  Future<Map<String, double>> fetchTokenUsdPrices(
+    int chainId,
+    List<TrackedToken> tokens,
+  ) async {
+    final platform = ChainConfig.known[chainId]?.coingeckoPlatform;
+    if (platform == null) {
+      return <String, double>{};
+    }
+
+    final contractAddresses = tokens
+        .where((token) => token.coingeckoId != null)
+        .map((token) => token.address.toLowerCase())
+        .toSet()
+        .toList();
+
+    return _inChunks(
+      contractAddresses,
+      (chunk) => _fetchTokenUsdPrices(platform, chunk),
+    );
+  }
+
+  Future<Map<String, double>> _fetchTokenUsdPrices(
+    String platform,
+    List<String> contractAddresses,
+  ) async {
+    try {
+      final uri = Uri.https(host, '/api/v3/simple/token_price/$platform', {
+        'contract_addresses': contractAddresses.join(','),
+        'vs_currencies': 'usd',
+      });
+      final response = await _httpClient.get(uri);
+      if (response.statusCode != 200) {
+        return <String, double>{};
+      }
+      final decoded = jsonDecode(response.body) as Map<String, dynamic>;
+      return decoded.map((key, value) {
+        final price = (value as Map<String, dynamic>)['usd'];
+        return MapEntry(key.toLowerCase(), price is num ? price.toDouble() : 0);
+      });
+    } catch (_) {
+      return <String, double>{};
+    }
+  }
+
+  // Runs [fetch] on slices of at most [maxIdsPerRequest] keys in parallel
+  // and merges the answers; a failed slice only loses its own prices.
+  static Future<Map<String, double>> _inChunks(
+    List<String> keys,
+    Future<Map<String, double>> Function(List<String> chunk) fetch,
+  ) async {
+    if (keys.isEmpty) {
+      return <String, double>{};
+    }
+    final answers = await Future.wait([
+      for (var start = 0; start < keys.length; start += maxIdsPerRequest)
+        fetch(keys.sublist(start, math.min(start + maxIdsPerRequest, keys.length))),
+    ]);
+    return {for (final answer in answers) ...answer};
+  }
+
+  void dispose() {
+    if (_ownsClient) {
+      _httpClient.close();
+    }
+  }
+}
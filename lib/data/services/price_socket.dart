@@ -0,0 +1,2 @@
+export 'price_socket_io.dart'
+    if (dart.library.html) 'price_socket_web.dart';
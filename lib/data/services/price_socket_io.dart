@@ -0,0 +1,13 @@
+import 'dart:io';
+
+import 'package:crypto_treasury/data/services/price_feed.dart';
+
+/// Opens a [PriceSocket] to [uri] with `dart:io`.
+Future<PriceSocket> connectPriceSocket(Uri uri) async {
+  final socket = await WebSocket.connect(uri.toString());
+  return PriceSocket(
+    messages: socket.where((message) => message is String).cast<String>(),
+    send: socket.add,
+    close: socket.close,
+  );
+}
@@ -0,0 +1,39 @@
+import 'dart:async';
+// ignore: avoid_web_libraries_in_flutter
+import 'dart:html' as html;
+
+import 'package:crypto_treasury/data/services/price_feed.dart';
+
+/// Opens a [PriceSocket] to [uri] with the browser WebSocket.
+Future<PriceSocket> connectPriceSocket(Uri uri) async {
+  final socket = html.WebSocket(uri.toString());
+  final opened = Completer<void>();
+  final messages = StreamController<String>();
+
+  socket.onOpen.first.then((_) {
+    if (!opened.isCompleted) {
+      opened.complete();
+    }
+  });
+  socket.onError.listen((_) {
+    if (!opened.isCompleted) {
+      opened.completeError(StateError('WebSocket to $uri failed'));
+    } else {
+      messages.addError(StateError('WebSocket to $uri failed'));
+    }
+  });
+  socket.onMessage.listen((event) {
+    final data = event.data;
+    if (data is String) {
+      messages.add(data);
+    }
+  });
+  socket.onClose.first.then((_) => messages.close());
+
+  await opened.future;
+  return PriceSocket(
+    messages: messages.stream,
+    send: socket.sendString,
+    close: () async => socket.close(),
+  );
+}
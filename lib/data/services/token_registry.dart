@@ -0,0 +1,289 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:http/http.dart' as http;
+
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+
+/// Tracked tokens indexed by chain and by lowercase address.
+///
+/// Built from a Uniswap-style token list (`{"tokens": [{chainId, address,
+/// symbol, name, decimals, logoURI}]}`) or from the compact binary form
+/// written by [encodeCompact]. Repeated strings (names, symbols, logo URLs)
+/// are interned while loading, so tokens that share a value share one String.
+class TokenRegistry {
+  TokenRegistry._(this._byChain, this._byAddress, this.length);
+
+  /// Indexes [tokens]; the first token wins when a chain and address repeat.
+  factory TokenRegistry.fromTokens(Iterable<TrackedToken> tokens) {
+    final byChain = <int, List<TrackedToken>>{};
+    final byAddress = <int, Map<String, TrackedToken>>{};
+    var length = 0;
+    for (final token in tokens) {
+      final addresses = byAddress.putIfAbsent(token.chainId, () => {});
+      final key = token.address.toLowerCase();
+      if (addresses.containsKey(key)) {
+        continue;
+      }
+      addresses[key] = token;
+      byChain.putIfAbsent(token.chainId, () => []).add(token);
+      length++;
+    }
+    return TokenRegistry._(
+      {
+        for (final entry in byChain.entries)
+          entry.key: List.unmodifiable(entry.value),
+      },
+      byAddress,
+      length,
+    );
+  }
+
+  /// Parses a Uniswap-style token list. `extensions.coingeckoId`, when
+  /// present, is kept for price lookups. Malformed entries are skipped.
+  factory TokenRegistry.parseTokenList(String source) {
+    final decoded = jsonDecode(source);
+    final entries = decoded is Map ? decoded['tokens'] : decoded;
+    if (entries is! List) {
+      throw const FormatException('Token list has no "tokens" array');
+    }
+
+    final strings = _StringPool();
+    final tokens = <TrackedToken>[];
+    for (final entry in entries) {
+      if (entry is! Map) {
+        continue;
+      }
+      final chainId = entry['chainId'];
+      final address = entry['address'];
+      final symbol = entry['symbol'];
+      final name = entry['name'];
+      final decimals = entry['decimals'];
+      if (chainId is! int ||
+          address is! String ||
+          symbol is! String ||
+          name is! String ||
+          decimals is! int) {
+        continue;
+      }
+      final extensions = entry['extensions'];
+      final coingeckoId = extensions is Map ? extensions['coingeckoId'] : null;
+      final logoUri = entry['logoURI'];
+      tokens.add(
+        TrackedToken(
+          chainId: chainId,
+          address: address.toLowerCase(),
+          symbol: strings.intern(symbol),
+          name: strings.intern(name),
+          decimals: decimals,
+          coingeckoId: coingeckoId is String ? strings.intern(coingeckoId) : null,
+          logoUrl: logoUri is String ? strings.intern(logoUri) : null,
+        ),
+      );
+    }
+    return TokenRegistry.fromTokens(tokens);
+  }
+
+  /// Decodes the output of [encodeCompact].
+  factory TokenRegistry.decodeCompact(Uint8List bytes) {
+    if (!isCompact(bytes)) {
+      throw const FormatException('Not a compact token list');
+    }
+    final reader = _Reader(bytes)..offset = _magic.length;
+
+    final strings = List<String>.generate(reader.uint32(), (_) {
+      final length = reader.uint16();
+      final value = utf8.decode(
+        Uint8List.sublistView(bytes, reader.offset, reader.offset + length),
+      );
+      reader.offset += length;
+      return value;
+    }, growable: false);
+    String? optional(int index) => index == 0 ? null : strings[index - 1];
+
+    final count = reader.uint32();
+    final tokens = List<TrackedToken>.generate(count, (_) {
+      final chainId = reader.uint32();
+      final address = reader.address();
+      return TrackedToken(
+        chainId: chainId,
+        address: address,
+        symbol: strings[reader.uint32()],
+        name: strings[reader.uint32()],
+        decimals: reader.uint8(),
+        logoUrl: optional(reader.uint32()),
+        coingeckoId: optional(reader.uint32()),
+      );
+    }, growable: false);
+    return TokenRegistry.fromTokens(tokens);
+  }
+
+  /// Fetches a token list from [uri], as JSON or compact binary.
+  static Future<TokenRegistry> load(Uri uri, {http.Client? httpClient}) async {
+    final client = httpClient ?? http.Client();
+    try {
+      final response = await client.get(uri);
+      if (response.statusCode != 200) {
+        throw http.ClientException(
+          'HTTP ${response.statusCode} loading token list',
+          uri,
+        );
+      }
+      final bytes = response.bodyBytes;
+      return isCompact(bytes)
+          ? TokenRegistry.decodeCompact(bytes)
+          : TokenRegistry.parseTokenList(utf8.decode(bytes));
+    } finally {
+      if (httpClient == null) {
+        client.close();
+      }
+    }
+  }
+
+  static bool isCompact(Uint8List bytes) {
+    if (bytes.length < _magic.length) {
+      return false;
+    }
+    for (var i = 0; i < _magic.length; i++) {
+      if (bytes[i] != _magic[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static const List<int> _magic = [0x56, 0x54, 0x4c, 0x31]; // "VTL1"
+
+  final Map<int, List<TrackedToken>> _byChain;
+  final Map<int, Map<String, TrackedToken>> _byAddress;
+
+  /// Number of distinct tokens across all chains.
+  final int length;
+
+  Iterable<int> get chainIds => _byChain.keys;
+
+  /// Tokens on [chainId] in list order.
+  List<TrackedToken> tokensOn(int chainId) => _byChain[chainId] ?? const [];
+
+  /// Token at [address] (any case) on [chainId].
+  TrackedToken? lookup(int chainId, String address) =>
+      _byAddress[chainId]?[address.toLowerCase()];
+
+  Iterable<TrackedToken> get tokens => _byChain.values.expand((list) => list);
+
+  /// Binary form of the registry: a string table followed by fixed-size
+  /// token records, with addresses as raw 20-byte values.
+  ///
+  /// Layout (little endian): "VTL1", u32 string count, per string u16 UTF-8
+  /// length and bytes, u32 token count, per token u32 chainId, 20-byte
+  /// address, u32 symbol, u32 name, u8 decimals, u32 logoURI + 1 and
+  /// u32 coingeckoId + 1 (0 = none).
+  Uint8List encodeCompact() {
+    final indices = <String, int>{};
+    final table = <Uint8List>[];
+    int indexOf(String value) => indices.putIfAbsent(value, () {
+      table.add(utf8.encode(value));
+      return table.length - 1;
+    });
+    int optional(String? value) => value == null ? 0 : indexOf(value) + 1;
+
+    final records = [
+      for (final token in tokens)
+        (
+          token,
+          indexOf(token.symbol),
+          indexOf(token.name),
+          optional(token.logoUrl),
+          optional(token.coingeckoId),
+        ),
+    ];
+    final tableSize = table.fold(0, (size, bytes) => size + 2 + bytes.length);
+    final bytes = Uint8List(
+      _magic.length + 4 + tableSize + 4 + records.length * _recordSize,
+    );
+    final data = ByteData.sublistView(bytes);
+    bytes.setAll(0, _magic);
+    var offset = _magic.length;
+
+    data.setUint32(offset, table.length, Endian.little);
+    offset += 4;
+    for (final value in table) {
+      if (value.length > 0xffff) {
+        throw const FormatException('Token list string too long');
+      }
+      data.setUint16(offset, value.length, Endian.little);
+      bytes.setAll(offset + 2, value);
+      offset += 2 + value.length;
+    }
+
+    data.setUint32(offset, records.length, Endian.little);
+    offset += 4;
+    for (final (token, symbol, name, logo, coingecko) in records) {
+      data.setUint32(offset, token.chainId, Endian.little);
+      _writeAddress(bytes, offset + 4, token.address);
+      data.setUint32(offset + 24, symbol, Endian.little);
+      data.setUint32(offset + 28, name, Endian.little);
+      data.setUint8(offset + 32, token.decimals);
+      data.setUint32(offset + 33, logo, Endian.little);
+      data.setUint32(offset + 37, coingecko, Endian.little);
+      offset += _recordSize;
+    }
+    return bytes;
+  }
+
+  static const int _recordSize = 41;
+
+  static void _writeAddress(Uint8List target, int offset, String address) {
+    final hex = address.startsWith('0x') ? address.substring(2) : address;
+    if (hex.length != 40) {
+      throw FormatException('Not a 20-byte address', address);
+    }
+    for (var i = 0; i < 20; i++) {
+      target[offset + i] = int.parse(hex.substring(i * 2, i * 2 + 2), radix: 16);
+    }
+  }
+}
+
+// Canonical instance per distinct string while a list is loading.
+class _StringPool {
+  final Map<String, String> _pool = {};
+
+  String intern(String value) => _pool.putIfAbsent(value, () => value);
+}
+
+class _Reader {
+  _Reader(this.bytes) : _data = ByteData.sublistView(bytes);
+
+  static final List<String> _hexBytes = List.generate(
+    256,
+    (value) => value.toRadixString(16).padLeft(2, '0'),
+    growable: false,
+  );
+
+  final Uint8List bytes;
+  final ByteData _data;
+  int offset = 0;
+
+  int uint8() => _data.getUint8(offset++);
+
+  int uint16() {
+    final value = _data.getUint16(offset, Endian.little);
+    offset += 2;
+    return value;
+  }
+
+  int uint32() {
+    final value = _data.getUint32(offset, Endian.little);
+    offset += 4;
+    return value;
+  }
+
+  String address() {
+    final buffer = StringBuffer('0x');
+    for (var i = 0; i < 20; i++) {
+      buffer.write(_hexBytes[bytes[offset + i]]);
+    }
+    offset += 20;
+    return buffer.toString();
+  }
+}
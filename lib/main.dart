@@ -13,15 +13,30 @@ final goRouterProvider = Provider<GoRouter>((ref) {
   return GoRouter(
     initialLocation: '/',
     routes: [
-      GoRoute(
-        path: '/',
-        name: 'landing',
-        builder: (context, state) => const LandingView(),
-      ),
-      GoRoute(
-        path: '/vault',
-        name: 'vault',
-        builder: (context, state) => const VaultView(),
+      // Each branch keeps its navigator alive, so leaving /vault only hides the
+      // Unity iframe instead of tearing down and reloading the WebGL player.
+      StatefulShellRoute.indexedStack(
+        builder: (context, state, navigationShell) => navigationShell,
+        branches: [
+          StatefulShellBranch(
+            routes: [
+              GoRoute(
+                path: '/',
+                name: 'landing',
+                builder: (context, state) => const LandingView(),
+              ),
+            ],
+          ),
+          StatefulShellBranch(
+            routes: [
+              GoRoute(
+                path: '/vault',
+                name: 'vault',
+                builder: (context, state) => const VaultView(),
+              ),
+            ],
+          ),
+        ],
       ),
     ],
   );
@@ -0,0 +1,38 @@
+import 'package:intl/intl.dart';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+
+/// The strings an asset card shows, formatted once per asset instance.
+///
+/// Wallet updates replace only the assets that changed, so scrolling and
+/// rebuilds reuse these instead of formatting again.
+class AssetDisplay {
+  AssetDisplay._(CryptoAsset asset)
+    : symbol = asset.symbol,
+      name = asset.name,
+      initial = asset.symbol.isEmpty ? '?' : asset.symbol.substring(0, 1),
+      balance = _balanceFormat.format(asset.normalizedBalance),
+      usdValue = usd(asset.usdValue.toDouble()),
+      logoUrl = asset.logoUrl;
+
+  static final Expando<AssetDisplay> _cache = Expando('AssetDisplay');
+
+  // NumberFormat parses its pattern on construction; share one of each.
+  static final NumberFormat _balanceFormat = NumberFormat('#,##0.####');
+  static final NumberFormat _usdFormat = NumberFormat.simpleCurrency();
+
+  final String symbol;
+  final String name;
+
+  /// First letter of [symbol], shown when there is no logo.
+  final String initial;
+  final String balance;
+  final String usdValue;
+  final String? logoUrl;
+
+  static AssetDisplay of(CryptoAsset asset) =>
+      _cache[asset] ??= AssetDisplay._(asset);
+
+  /// [value] as the local currency string used across the vault.
+  static String usd(double value) => _usdFormat.format(value);
+}
@@ -0,0 +1,70 @@
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+
+/// Orders the vault asset grid can be shown in.
+enum AssetSort { wallet, value, symbol }
+
+/// How the asset grid is sorted and which assets it shows.
+class AssetGridQuery {
+  const AssetGridQuery({this.sort = AssetSort.wallet, this.filter = ''});
+
+  final AssetSort sort;
+
+  /// Case-insensitive text matched against symbol and name; empty shows all.
+  final String filter;
+
+  /// Whether the grid shows the wallet's assets as they are.
+  bool get isDefault => sort == AssetSort.wallet && filter.isEmpty;
+
+  @override
+  bool operator ==(Object other) =>
+      other is AssetGridQuery && other.sort == sort && other.filter == filter;
+
+  @override
+  int get hashCode => Object.hash(sort, filter);
+}
+
+class AssetGridViewModel extends StateNotifier<AssetGridQuery> {
+  AssetGridViewModel() : super(const AssetGridQuery());
+
+  void setSort(AssetSort sort) {
+    if (sort != state.sort) {
+      state = AssetGridQuery(sort: sort, filter: state.filter);
+    }
+  }
+
+  void setFilter(String filter) {
+    final trimmed = filter.trim();
+    if (trimmed != state.filter) {
+      state = AssetGridQuery(sort: state.sort, filter: trimmed);
+    }
+  }
+}
+
+/// One asset as needed to order the grid; plain data so it can be sent to
+/// a background isolate.
+typedef AssetOrderRow = ({String key, String symbol, String name, double usd});
+
+/// Keys of [rows] matching [query], in the order it asks for.
+List<String> orderAssetRows((List<AssetOrderRow>, AssetGridQuery) input) {
+  final (rows, query) = input;
+  final needle = query.filter.toLowerCase();
+  final shown = [
+    for (var i = 0; i < rows.length; i++)
+      if (needle.isEmpty ||
+          rows[i].symbol.toLowerCase().contains(needle) ||
+          rows[i].name.toLowerCase().contains(needle))
+        i,
+  ];
+  // Ties keep wallet order; List.sort itself is not stable.
+  int stable(int a, int b, int order) => order != 0 ? order : a.compareTo(b);
+  switch (query.sort) {
+    case AssetSort.wallet:
+      break;
+    case AssetSort.value:
+      shown.sort((a, b) => stable(a, b, rows[b].usd.compareTo(rows[a].usd)));
+    case AssetSort.symbol:
+      final symbols = [for (final row in rows) row.symbol.toLowerCase()];
+      shown.sort((a, b) => stable(a, b, symbols[a].compareTo(symbols[b])));
+  }
+  return [for (final i in shown) rows[i].key];
+}
@@ -1,17 +1,189 @@
+import 'package:flutter/foundation.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/repositories/history_repository.dart';
 import 'package:crypto_treasury/data/repositories/wallet_repository.dart';
+import 'package:crypto_treasury/data/services/price_feed.dart';
+import 'package:crypto_treasury/ui/featuers/vault/widgets/asset_logo_cache.dart';
 
+import 'asset_grid_view_model.dart';
+import 'unity_wallet_projection.dart';
+import 'vault_frame_stats_view_model.dart';
+import 'vault_interaction_view_model.dart';
 import 'wallet_view_model.dart';
 
+// Optional token list, e.g. --dart-define=TOKEN_LIST_URL=https://.../tokens.json
+const String _tokenListUrl = String.fromEnvironment('TOKEN_LIST_URL');
+
+// Optional price stream, e.g. --dart-define=PRICE_STREAM_URL=wss://.../prices
+const String _priceStreamUrl = String.fromEnvironment('PRICE_STREAM_URL');
+
 final walletRepositoryProvider = Provider<WalletRepository>((ref) {
-  final repository = WalletRepository();
+  final repository = WalletRepository(
+    tokenListUri: _tokenListUrl.isEmpty ? null : Uri.parse(_tokenListUrl),
+    priceFeed: PriceFeed(
+      streamUri: _priceStreamUrl.isEmpty ? null : Uri.parse(_priceStreamUrl),
+    ),
+  );
   ref.onDispose(repository.dispose);
   return repository;
 });
 
+final historyRepositoryProvider = Provider<HistoryRepository>(
+  (ref) => HistoryRepository(),
+);
+
 final walletViewModelProvider =
     StateNotifierProvider<WalletViewModel, WalletUiState>((ref) {
       final repository = ref.watch(walletRepositoryProvider);
-      return WalletViewModel(repository);
+      final history = ref.watch(historyRepositoryProvider);
+      final viewModel = WalletViewModel(repository);
+      // Snapshots each complete wallet once: a finished load, then every
+      // tracker or price update over it. Partial wallets of a load, which
+      // show old or missing balances, are never recorded.
+      CryptoWallet? recorded;
+      viewModel.addListener((state) {
+        final wallet = state.wallet;
+        if (wallet != null &&
+            !identical(wallet, recorded) &&
+            !state.isPartial) {
+          recorded = wallet;
+          history.record(wallet);
+        }
+      }, fireImmediately: false);
+      return viewModel;
     });
+
+// Slices of [walletViewModelProvider] for widgets that show one concern, so
+// a spinner toggling or one price moving rebuilds only what shows it.
+
+/// Flags that drive the vault chrome, without the wallet itself.
+typedef WalletStatus = ({
+  bool isSupported,
+  bool hasWallet,
+  bool isConnecting,
+  bool isRefreshing,
+  bool isPortfolio,
+});
+
+final walletStatusProvider = Provider<WalletStatus>(
+  (ref) => ref.watch(
+    walletViewModelProvider.select(
+      (state) => (
+        isSupported: state.isSupported,
+        hasWallet: state.isConnected,
+        isConnecting: state.isConnecting,
+        isRefreshing: state.isRefreshing,
+        isPortfolio: state.isPortfolio,
+      ),
+    ),
+  ),
+);
+
+final walletProvider = Provider<CryptoWallet?>(
+  (ref) => ref.watch(walletViewModelProvider.select((state) => state.wallet)),
+);
+
+/// The Unity payload; changes with the wallet version only.
+final walletUnityProvider = Provider<UnityWalletProjection>(
+  (ref) => ref.watch(walletViewModelProvider.select((state) => state.unity)),
+);
+
+/// The wallet's assets by [CryptoAsset.key], in wallet order.
+final walletAssetsByKeyProvider = Provider<Map<String, CryptoAsset>>((ref) {
+  final assets = ref.watch(walletProvider)?.assets ?? const <CryptoAsset>[];
+  return {for (final asset in assets) asset.key: asset};
+});
+
+/// [CryptoAsset.key] of each asset in wallet order; changes only when assets
+/// are added, removed or reordered.
+final walletAssetKeysProvider = Provider<List<String>>(
+  (ref) => ref
+      .watch(
+        walletAssetsByKeyProvider.select((assets) => _AssetKeys(assets.keys)),
+      )
+      .keys,
+);
+
+/// One asset by [CryptoAsset.key]; notifies only when that asset changes.
+final walletAssetProvider = Provider.autoDispose
+    .family<CryptoAsset?, String>(
+      (ref, key) => ref.watch(
+        walletAssetsByKeyProvider.select((assets) => assets[key]),
+      ),
+    );
+
+final assetGridProvider =
+    StateNotifierProvider<AssetGridViewModel, AssetGridQuery>(
+      (ref) => AssetGridViewModel(),
+    );
+
+// Wallets above this size are sorted and filtered on a background isolate.
+// On the web, compute() runs on the main thread instead.
+const int _orderOffThreadAbove = 1000;
+
+final _orderedAssetKeysProvider = FutureProvider<List<String>>((ref) async {
+  final query = ref.watch(assetGridProvider);
+  // Only a value sort depends on prices; the others follow the keys alone.
+  final Map<String, CryptoAsset> assets;
+  if (query.sort == AssetSort.value) {
+    assets = ref.watch(walletAssetsByKeyProvider);
+  } else {
+    ref.watch(walletAssetKeysProvider);
+    assets = ref.read(walletAssetsByKeyProvider);
+  }
+  final rows = [
+    for (final MapEntry(key: key, value: asset) in assets.entries)
+      (
+        key: key,
+        symbol: asset.symbol,
+        name: asset.name,
+        usd: asset.usdValue.toDouble(),
+      ),
+  ];
+  return rows.length > _orderOffThreadAbove
+      ? compute(orderAssetRows, (rows, query))
+      : orderAssetRows((rows, query));
+});
+
+/// Keys of the assets the grid shows, per [assetGridProvider]. While a new
+/// order is computed the previous one stays on screen.
+final visibleAssetKeysProvider = Provider<List<String>>((ref) {
+  final walletOrder = ref.watch(walletAssetKeysProvider);
+  if (ref.watch(assetGridProvider.select((query) => query.isDefault))) {
+    return walletOrder;
+  }
+  return ref.watch(
+        _orderedAssetKeysProvider.select((order) => order.valueOrNull),
+      ) ??
+      walletOrder;
+});
+
+final assetLogoCacheProvider = Provider<AssetLogoCache>(
+  (ref) => AssetLogoCache(),
+);
+
+class _AssetKeys {
+  _AssetKeys(Iterable<String> keys) : keys = List.unmodifiable(keys);
+
+  final List<String> keys;
+
+  @override
+  bool operator ==(Object other) =>
+      other is _AssetKeys && listEquals(other.keys, keys);
+
+  @override
+  int get hashCode => Object.hashAll(keys);
+}
+
+final vaultInteractionProvider =
+    StateNotifierProvider<VaultInteractionViewModel, VaultInteractionState>(
+      (ref) => VaultInteractionViewModel(),
+    );
+
+final vaultFrameStatsProvider =
+    StateNotifierProvider<VaultFrameStatsViewModel, List<VaultFrameStats>>(
+      (ref) => VaultFrameStatsViewModel(),
+    );
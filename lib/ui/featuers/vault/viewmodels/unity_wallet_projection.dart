@@ -0,0 +1,71 @@
+import 'dart:convert';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+
+/// The `setWallet` message for the Unity player, built at most once per
+/// wallet [version].
+///
+/// [WalletUiState] creates a new projection only when its wallet's coins
+/// change, so rebuilds for loader, error or price changes reuse the same
+/// balances and encoded payload, and the panel can skip by comparing
+/// versions.
+class UnityWalletProjection {
+  UnityWalletProjection(this.version, this._wallet);
+
+  static final UnityWalletProjection empty = UnityWalletProjection(0, null);
+
+  /// Increases by one whenever the projected coins change.
+  final int version;
+  final CryptoWallet? _wallet;
+
+  /// One entry per asset, in wallet order: `symbol`, `amount` and, when
+  /// known, `logoUrl`. Unity refers to coins by index into this list.
+  late final List<Map<String, Object?>> balances = List.unmodifiable(
+    (_wallet?.assets ?? const []).map((asset) {
+      final amount = asset.normalizedBalance;
+      return Map<String, Object?>.unmodifiable({
+        'symbol': asset.symbol.toUpperCase(),
+        'amount': amount < 0 ? 0 : amount,
+        if (asset.logoUrl != null) 'logoUrl': asset.logoUrl,
+      });
+    }),
+  );
+
+  /// [balances] encoded as a WalletMessage JSON string.
+  late final String payload = jsonEncode({
+    'type': 'setWallet',
+    'balances': balances,
+  });
+
+  /// Projects [wallet] as the version after this one, or returns this
+  /// projection when [wallet] has the same coins, e.g. after repricing.
+  UnityWalletProjection next(CryptoWallet? wallet) => _sameCoins(_wallet, wallet)
+      ? this
+      : UnityWalletProjection(version + 1, wallet);
+
+  // Compares only what [balances] is built from; USD values are not sent.
+  static bool _sameCoins(CryptoWallet? previous, CryptoWallet? wallet) {
+    if (previous == null || wallet == null) {
+      return identical(previous, wallet);
+    }
+    final before = previous.assets;
+    final after = wallet.assets;
+    if (identical(before, after)) {
+      return true;
+    }
+    if (before.length != after.length) {
+      return false;
+    }
+    for (var i = 0; i < after.length; i++) {
+      final a = before[i];
+      final b = after[i];
+      if (!identical(a, b) &&
+          (a.symbol != b.symbol ||
+              a.amount != b.amount ||
+              a.logoUrl != b.logoUrl)) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
@@ -0,0 +1,99 @@
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+
+/// One `frameStats` report from the Unity perf sampler (PerfSampler.cs).
+/// Times are milliseconds over the sampler's rolling window.
+class VaultFrameStats {
+  const VaultFrameStats({
+    required this.frames,
+    required this.frameP50,
+    required this.frameP95,
+    required this.mainP50,
+    required this.mainP95,
+    required this.physicsP95,
+    required this.renderP95,
+    required this.gcAllocBytes,
+    required this.coins,
+    required this.batches,
+    required this.instancedBatches,
+    required this.logoTextures,
+    required this.logoBytes,
+    required this.logoFormat,
+    required this.logoDecodes,
+    required this.logoDecodeMsMax,
+    required this.coinTriangles,
+    required this.coinsReduced,
+    required this.coinsImpostor,
+    required this.coinsHidden,
+  });
+
+  factory VaultFrameStats.fromJson(Map<dynamic, dynamic> json) {
+    double ms(String key) => (json[key] as num?)?.toDouble() ?? 0;
+    int count(String key) => (json[key] as num?)?.toInt() ?? 0;
+
+    return VaultFrameStats(
+      frames: count('frames'),
+      frameP50: ms('frameP50'),
+      frameP95: ms('frameP95'),
+      mainP50: ms('mainP50'),
+      mainP95: ms('mainP95'),
+      physicsP95: ms('physicsP95'),
+      renderP95: ms('renderP95'),
+      gcAllocBytes: count('gcAllocBytes'),
+      coins: count('coins'),
+      batches: count('batches'),
+      instancedBatches: count('instancedBatches'),
+      logoTextures: count('logoTextures'),
+      logoBytes: count('logoBytes'),
+      logoFormat: json['logoFormat'] as String? ?? '',
+      logoDecodes: count('logoDecodes'),
+      logoDecodeMsMax: ms('logoDecodeMsMax'),
+      coinTriangles: count('coinTriangles'),
+      coinsReduced: count('coinsReduced'),
+      coinsImpostor: count('coinsImpostor'),
+      coinsHidden: count('coinsHidden'),
+    );
+  }
+
+  final int frames;
+  final double frameP50;
+  final double frameP95;
+  final double mainP50;
+  final double mainP95;
+  final double physicsP95;
+  final double renderP95;
+  final int gcAllocBytes;
+  final int coins;
+  final int batches;
+  final int instancedBatches;
+
+  /// Resident token logos, their estimated GPU bytes and the format bundled
+  /// logos load in (`astc`, `etc2`, `dxt` or `png`).
+  final int logoTextures;
+  final int logoBytes;
+  final String logoFormat;
+
+  /// Logos decoded or uploaded since the previous report, and the slowest.
+  final int logoDecodes;
+  final double logoDecodeMsMax;
+
+  /// Coin triangles submitted last frame, and how many coins were drawn with
+  /// the reduced mesh, the impostor, or not at all (buried in the pile).
+  final int coinTriangles;
+  final int coinsReduced;
+  final int coinsImpostor;
+  final int coinsHidden;
+}
+
+/// Keeps the most recent reports for charting, oldest first.
+class VaultFrameStatsViewModel extends StateNotifier<List<VaultFrameStats>> {
+  VaultFrameStatsViewModel() : super(const []);
+
+  static const int historyLength = 60;
+
+  void add(VaultFrameStats stats) {
+    final history = state.length >= historyLength
+        ? state.sublist(state.length - historyLength + 1)
+        : state;
+    state = [...history, stats];
+  }
+}
@@ -0,0 +1,37 @@
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+
+import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_coin_selection.dart';
+
+/// What the user is pointing at, has picked, and is orbiting in the Unity vault.
+class VaultInteractionState {
+  const VaultInteractionState({this.hovered, this.selected, this.focused});
+
+  final VaultCoinSelection? hovered;
+  final VaultCoinSelection? selected;
+  final VaultCoinSelection? focused;
+
+  @override
+  bool operator ==(Object other) =>
+      other is VaultInteractionState &&
+      other.hovered == hovered &&
+      other.selected == selected &&
+      other.focused == focused;
+
+  @override
+  int get hashCode => Object.hash(hovered, selected, focused);
+}
+
+class VaultInteractionViewModel extends StateNotifier<VaultInteractionState> {
+  VaultInteractionViewModel() : super(const VaultInteractionState());
+
+  /// Applies the events of one Unity frame as a single state change, so
+  /// listeners rebuild at most once per frame however many events arrived.
+  void applyFrame(VaultInteractionState next) {
+    if (next == state) {
+      return;
+    }
+    state = next;
+  }
+
+  void clear() => applyFrame(const VaultInteractionState());
+}
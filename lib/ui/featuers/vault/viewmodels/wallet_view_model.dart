@@ -3,17 +3,23 @@ import 'dart:async';
 import 'package:flutter/foundation.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
 import 'package:crypto_treasury/data/models/crypto_wallet.dart';
 import 'package:crypto_treasury/data/repositories/wallet_repository.dart';
 
+import 'unity_wallet_projection.dart';
+
 class WalletUiState {
-  const WalletUiState({
+  WalletUiState({
     this.wallet,
     required this.isSupported,
     required this.isConnecting,
     required this.isRefreshing,
+    this.isPortfolio = false,
+    this.isPartial = false,
     this.errorMessage,
-  });
+    UnityWalletProjection? unity,
+  }) : unity = unity ?? UnityWalletProjection.empty.next(wallet);
 
   factory WalletUiState.initial({required bool isSupported}) {
     return WalletUiState(
@@ -29,8 +35,22 @@ class WalletUiState {
   final bool isSupported;
   final bool isConnecting;
   final bool isRefreshing;
+
+  /// Whether [wallet] covers every configured chain rather than the chain
+  /// selected in MetaMask.
+  final bool isPortfolio;
+
+  /// Whether [wallet] may lack balances because its load is still streaming
+  /// in or failed part way.
+  final bool isPartial;
   final String? errorMessage;
 
+  /// Unity payload for [wallet]; carried over unchanged unless its coins
+  /// change, so repricing alone never re-projects.
+  final UnityWalletProjection unity;
+
+  int get walletVersion => unity.version;
+
   bool get isConnected => wallet != null;
 
   WalletUiState copyWith({
@@ -38,16 +58,22 @@ class WalletUiState {
     bool? isSupported,
     bool? isConnecting,
     bool? isRefreshing,
+    bool? isPortfolio,
+    bool? isPartial,
     String? errorMessage,
     bool clearError = false,
     bool clearWallet = false,
   }) {
+    final nextWallet = clearWallet ? null : (wallet ?? this.wallet);
     return WalletUiState(
-      wallet: clearWallet ? null : (wallet ?? this.wallet),
+      wallet: nextWallet,
       isSupported: isSupported ?? this.isSupported,
       isConnecting: isConnecting ?? this.isConnecting,
       isRefreshing: isRefreshing ?? this.isRefreshing,
+      isPortfolio: isPortfolio ?? this.isPortfolio,
+      isPartial: isPartial ?? this.isPartial,
       errorMessage: clearError ? null : (errorMessage ?? this.errorMessage),
+      unity: identical(nextWallet, this.wallet) ? unity : unity.next(nextWallet),
     );
   }
 }
@@ -62,6 +88,14 @@ class WalletViewModel extends StateNotifier<WalletUiState> {
 
   StreamSubscription<List<String>>? _accountSubscription;
   StreamSubscription<int>? _chainSubscription;
+  StreamSubscription<CryptoWallet>? _walletSubscription;
+  Completer<void>? _walletLoad;
+  StreamSubscription<CryptoWallet>? _trackSubscription;
+  StreamSubscription<Map<String, double>>? _priceSubscription;
+  Set<String> _pricedSymbols = const {};
+
+  // Latest streamed USD price per symbol, applied over every wallet shown.
+  final Map<String, double> _livePrices = {};
 
   void _init() {
     if (_repository.isConnected) {
@@ -81,25 +115,21 @@ class WalletViewModel extends StateNotifier<WalletUiState> {
 
     debugPrint('[WalletViewModel] connectWallet() starting');
     state = state.copyWith(isConnecting: true, clearError: true);
-    try {
-      final wallet = await _repository.connectWallet();
-      debugPrint('[WalletViewModel] connectWallet() wallet=' + (wallet == null ? 'null' : wallet.address));
-      state = state.copyWith(
-        wallet: wallet,
-        isConnecting: false,
-        clearError: true,
-      );
-    } catch (error) {
-      debugPrint('[WalletViewModel] connectWallet() error: ' + error.toString());
-      state = state.copyWith(
-        isConnecting: false,
-        errorMessage: error.toString(),
-      );
-    }
+    await _follow(_repository.connectWallet(), 'connectWallet');
   }
 
   Future<void> refreshWallet() => _refreshWallet();
 
+  /// Switches between the MetaMask chain and the multi-chain portfolio, and
+  /// reloads.
+  Future<void> setPortfolioMode(bool enabled) async {
+    if (state.isPortfolio == enabled) {
+      return;
+    }
+    state = state.copyWith(isPortfolio: enabled);
+    await _refreshWallet();
+  }
+
   Future<void> _refreshWallet({bool silent = false}) async {
     if (!state.isSupported) {
       return;
@@ -110,34 +140,28 @@ class WalletViewModel extends StateNotifier<WalletUiState> {
       state = state.copyWith(isRefreshing: true, clearError: true);
     }
 
-    try {
-      final wallet = await _repository.refreshWallet();
-      debugPrint('[WalletViewModel] _refreshWallet result wallet=' + (wallet == null ? 'null' : wallet.address));
-      state = state.copyWith(
-        wallet: wallet,
-        isRefreshing: false,
-        clearError: true,
-      );
-    } catch (error) {
-      debugPrint('[WalletViewModel] _refreshWallet error: ' + error.toString());
-      state = state.copyWith(
-        isRefreshing: false,
-        errorMessage: error.toString(),
-      );
-    }
+    await _follow(
+      state.isPortfolio
+          ? _repository.loadPortfolio()
+          : _repository.refreshWallet(),
+      '_refreshWallet',
+    );
   }
 
   void _handleAccountChange(List<String> accounts) {
     debugPrint('[WalletViewModel] _handleAccountChange: ' + accounts.toString());
     if (accounts.isEmpty) {
-      state = state.copyWith(clearWallet: true);
+      _clearWallet();
       return;
     }
 
     final primary = accounts.first;
     final chainId = _repository.currentChainId;
     if (chainId == null) {
-      state = state.copyWith(clearWallet: true);
+      _clearWallet();
+      return;
+    }
+    if (_isTracking(primary, chainId)) {
       return;
     }
 
@@ -146,9 +170,16 @@ class WalletViewModel extends StateNotifier<WalletUiState> {
 
   void _handleChainChange(int chainId) {
     debugPrint('[WalletViewModel] _handleChainChange: ' + chainId.toString());
+    if (state.isPortfolio) {
+      // The portfolio already covers every chain.
+      return;
+    }
     final address = _repository.currentAccount;
     if (address == null) {
-      state = state.copyWith(clearWallet: true);
+      _clearWallet();
+      return;
+    }
+    if (_isTracking(address, chainId)) {
       return;
     }
 
@@ -161,51 +192,171 @@ class WalletViewModel extends StateNotifier<WalletUiState> {
   }) async {
     debugPrint('[WalletViewModel] _loadWallet address=' + address + ', chainId=' + chainId.toString());
     state = state.copyWith(isRefreshing: true, clearError: true);
-    try {
-      final wallet = await _repository.loadWallet(
-        address: address,
-        chainId: chainId,
-      );
-      debugPrint('[WalletViewModel] _loadWallet result wallet=' + (wallet == null ? 'null' : wallet.address));
-      state = state.copyWith(
-        wallet: wallet,
-        isRefreshing: false,
-        clearError: true,
-      );
-    } catch (error) {
-      debugPrint('[WalletViewModel] _loadWallet error: ' + error.toString());
+    await _follow(
+      state.isPortfolio
+          ? _repository.loadPortfolio(address: address)
+          : _repository.loadWallet(address: address, chainId: chainId),
+      '_loadWallet',
+    );
+  }
+
+  // Applies each partial wallet as it arrives; a newer load replaces the one
+  // in progress. The returned future completes when [wallets] ends, fails or
+  // is replaced.
+  Future<void> _follow(Stream<CryptoWallet> wallets, String label) {
+    _stopFollowing();
+    final base = state.wallet;
+    final done = Completer<void>();
+    CryptoWallet? latest;
+    _walletLoad = done;
+
+    void finish({Object? error}) {
+      if (!identical(_walletLoad, done)) {
+        return;
+      }
+      _walletLoad = null;
+      _walletSubscription = null;
+      debugPrint('[WalletViewModel] ' + label + ' finished' + (error == null ? '' : ' with error: ' + error.toString()));
       state = state.copyWith(
+        wallet: latest == null
+            ? null
+            : _mergeWallet(base, latest!, complete: error == null)
+                  .repriced(_livePrices),
+        isConnecting: false,
         isRefreshing: false,
-        errorMessage: error.toString(),
+        // A load that failed before its first wallet leaves the shown one as is.
+        isPartial: latest == null ? null : error != null,
+        errorMessage: error?.toString(),
       );
+      final wallet = state.wallet;
+      if (error == null && wallet != null) {
+        _watchPrices(wallet);
+        if (!state.isPortfolio) {
+          _startTracking(wallet);
+        }
+      }
+      done.complete();
+    }
+
+    _walletSubscription = wallets.listen(
+      (wallet) {
+        latest = wallet;
+        state = state.copyWith(
+          wallet: _mergeWallet(base, wallet, complete: false).repriced(_livePrices),
+          isConnecting: false,
+          isPartial: true,
+          clearError: true,
+        );
+      },
+      onError: (Object error) => finish(error: error),
+      onDone: finish,
+      cancelOnError: true,
+    );
+    return done.future;
+  }
+
+  // Once a MetaMask wallet has fully loaded, block-by-block updates replace
+  // reloads until another load starts.
+  void _startTracking(CryptoWallet wallet) {
+    _trackSubscription = _repository.trackWallet(wallet).listen((updated) {
+      state = state.copyWith(wallet: updated.repriced(_livePrices));
+      _watchPrices(updated);
+    });
+  }
+
+  // Subscribes to live prices for the symbols in [wallet]; kept across
+  // reloads while the set of symbols stays the same.
+  void _watchPrices(CryptoWallet wallet) {
+    final symbols = {for (final asset in wallet.assets) asset.symbol};
+    if (_priceSubscription != null && setEquals(symbols, _pricedSymbols)) {
+      return;
     }
+    _priceSubscription?.cancel();
+    _pricedSymbols = symbols;
+    _priceSubscription = _repository.watchPrices(wallet).listen(_applyPrices);
+  }
+
+  // Revalues the assets whose price moved; balances are left untouched.
+  void _applyPrices(Map<String, double> prices) {
+    _livePrices.addAll(prices);
+    final wallet = state.wallet;
+    if (wallet == null) {
+      return;
+    }
+    final repriced = wallet.repriced(prices);
+    if (!identical(repriced, wallet)) {
+      state = state.copyWith(wallet: repriced);
+    }
+  }
+
+  void _stopPrices() {
+    _priceSubscription?.cancel();
+    _priceSubscription = null;
+    _pricedSymbols = const {};
+  }
+
+  void _clearWallet() {
+    _stopFollowing();
+    _stopPrices();
+    state = state.copyWith(clearWallet: true, isPartial: false);
+  }
+
+  // Whether the wallet on screen is already kept current for this account
+  // and chain, so a repeated MetaMask event needs no reload.
+  bool _isTracking(String address, int chainId) {
+    final wallet = state.wallet;
+    return _trackSubscription != null &&
+        wallet != null &&
+        wallet.chainId == chainId &&
+        wallet.address.toLowerCase() == address.toLowerCase();
+  }
+
+  void _stopFollowing() {
+    _trackSubscription?.cancel();
+    _trackSubscription = null;
+    _walletSubscription?.cancel();
+    _walletSubscription = null;
+    final load = _walletLoad;
+    _walletLoad = null;
+    load?.complete();
+  }
+
+  // A reload of the wallet already on screen keeps its asset order and shows
+  // the previous value of each asset until its new one arrives, so neither the
+  // grid nor the coin pile empties and refills. Assets missing from a
+  // [complete] load are dropped. Any other wallet is shown as it streams in.
+  static CryptoWallet _mergeWallet(
+    CryptoWallet? previous,
+    CryptoWallet incoming, {
+    required bool complete,
+  }) {
+    if (previous == null ||
+        previous.address != incoming.address ||
+        previous.chainId != incoming.chainId) {
+      return incoming;
+    }
+
+    final resolved = {for (final asset in incoming.assets) asset.key: asset};
+    final merged = <CryptoAsset>[];
+    for (final asset in previous.assets) {
+      final update = resolved.remove(asset.key);
+      if (update != null) {
+        merged.add(update);
+      } else if (!complete) {
+        merged.add(asset);
+      }
+    }
+    merged.addAll(resolved.values);
+    return incoming.copyWith(assets: List.unmodifiable(merged));
   }
 
   @override
   void dispose() {
     _accountSubscription?.cancel();
     _chainSubscription?.cancel();
+    _stopFollowing();
+    _stopPrices();
     _repository.dispose();
     super.dispose();
   }
 }
-
-extension WalletUiStateUnity on WalletUiState {
-  List<Map<String, dynamic>> toUnityBalances() {
-    final wallet = this.wallet;
-    if (wallet == null) {
-      return const [];
-    }
-
-    return wallet.assets
-        .map((asset) {
-          final amount = asset.normalizedBalance;
-          return {
-            'symbol': asset.symbol.toUpperCase(),
-            'amount': amount < 0 ? 0 : amount,
-          };
-        })
-        .toList();
-  }
-}
-
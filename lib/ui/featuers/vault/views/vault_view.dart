@@ -1,12 +1,17 @@
+import 'package:crypto_treasury/data/models/chain_breakdown.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/asset_display.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/asset_grid_view_model.dart';
 import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
-import 'package:crypto_treasury/ui/featuers/vault/viewmodels/wallet_view_model.dart';
 import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_asset_card.dart';
+import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_frame_stats_chart.dart';
 import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_unity_panel.dart';
 import 'package:flutter/material.dart';
 import 'package:flutter_riverpod/flutter_riverpod.dart';
 import 'package:go_router/go_router.dart';
-import 'package:intl/intl.dart';
 
+// Each part of the view watches only its slice of the wallet state (see the
+// selectors in providers.dart): the refresh spinner, a price tick or one
+// asset's balance rebuilds the widgets that show it, not the whole vault.
 class VaultView extends ConsumerStatefulWidget {
   const VaultView({super.key});
 
@@ -16,51 +21,34 @@ class VaultView extends ConsumerStatefulWidget {
 
 class _VaultViewState extends ConsumerState<VaultView> {
   bool _unityReady = false;
-  VaultCoinSelection? _selection;
 
   @override
   Widget build(BuildContext context) {
-    final walletState = ref.watch(walletViewModelProvider);
+    final (isSupported, hasWallet) = ref.watch(
+      walletStatusProvider.select(
+        (status) => (status.isSupported, status.hasWallet),
+      ),
+    );
 
     return Scaffold(
       appBar: AppBar(
         title: const Text('Vault Overview'),
-        actions: [
-          if (walletState.isRefreshing)
-            const Padding(
-              padding: EdgeInsets.symmetric(horizontal: 16),
-              child: Center(
-                child: SizedBox(
-                  width: 16,
-                  height: 16,
-                  child: CircularProgressIndicator(strokeWidth: 2),
-                ),
-              ),
-            ),
-          IconButton(
-            tooltip: 'Refresh balances',
-            onPressed: walletState.isRefreshing
-                ? null
-                : () => ref
-                    .read(walletViewModelProvider.notifier)
-                    .refreshWallet(),
-            icon: const Icon(Icons.refresh),
-          ),
+        actions: const [
+          _RefreshSpinner(),
+          _PortfolioToggle(),
+          _RefreshButton(),
         ],
       ),
       body: AnimatedSwitcher(
         duration: const Duration(milliseconds: 300),
-        child: !walletState.isSupported
+        child: !isSupported
             ? const _UnsupportedNotice(key: ValueKey('unsupported'))
-            : walletState.wallet == null
+            : !hasWallet
                 ? const _EmptyVaultState(key: ValueKey('empty'))
                 : _VaultContent(
                     key: const ValueKey('content'),
-                    walletState: walletState,
                     unityReady: _unityReady,
                     onUnityReady: _handleUnityReady,
-                    onCoinSelected: _handleCoinSelected,
-                    selection: _selection,
                   ),
       ),
     );
@@ -74,141 +62,282 @@ class _VaultViewState extends ConsumerState<VaultView> {
       _unityReady = ready;
     });
   }
+}
 
-  void _handleCoinSelected(VaultCoinSelection selection) {
-    setState(() {
-      _selection = selection;
-    });
+class _RefreshSpinner extends ConsumerWidget {
+  const _RefreshSpinner();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final isRefreshing = ref.watch(
+      walletStatusProvider.select((status) => status.isRefreshing),
+    );
+    if (!isRefreshing) {
+      return const SizedBox.shrink();
+    }
+    return const Padding(
+      padding: EdgeInsets.symmetric(horizontal: 16),
+      child: Center(
+        child: SizedBox(
+          width: 16,
+          height: 16,
+          child: CircularProgressIndicator(strokeWidth: 2),
+        ),
+      ),
+    );
+  }
+}
+
+class _PortfolioToggle extends ConsumerWidget {
+  const _PortfolioToggle();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final (isPortfolio, hasWallet) = ref.watch(
+      walletStatusProvider.select(
+        (status) => (status.isPortfolio, status.hasWallet),
+      ),
+    );
+    return IconButton(
+      tooltip: isPortfolio ? 'Show connected chain only' : 'Show all chains',
+      isSelected: isPortfolio,
+      onPressed: hasWallet
+          ? () => ref
+              .read(walletViewModelProvider.notifier)
+              .setPortfolioMode(!isPortfolio)
+          : null,
+      icon: const Icon(Icons.hub_outlined),
+      selectedIcon: const Icon(Icons.hub),
+    );
+  }
+}
+
+class _RefreshButton extends ConsumerWidget {
+  const _RefreshButton();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final isRefreshing = ref.watch(
+      walletStatusProvider.select((status) => status.isRefreshing),
+    );
+    return IconButton(
+      tooltip: 'Refresh balances',
+      onPressed: isRefreshing
+          ? null
+          : () => ref.read(walletViewModelProvider.notifier).refreshWallet(),
+      icon: const Icon(Icons.refresh),
+    );
   }
 }
 
 class _VaultContent extends StatelessWidget {
   const _VaultContent({
     super.key,
-    required this.walletState,
     required this.unityReady,
     required this.onUnityReady,
-    required this.onCoinSelected,
-    required this.selection,
   });
 
-  final WalletUiState walletState;
   final bool unityReady;
   final ValueChanged<bool> onUnityReady;
-  final ValueChanged<VaultCoinSelection> onCoinSelected;
-  final VaultCoinSelection? selection;
 
   @override
   Widget build(BuildContext context) {
-    final wallet = walletState.wallet!;
     final theme = Theme.of(context);
-    final balancesForUnity = walletState.toUnityBalances();
 
     return LayoutBuilder(
       builder: (context, constraints) {
         final estimatedCrossAxis = (constraints.maxWidth / 240).floor();
         final crossAxisCount = estimatedCrossAxis.clamp(1, 4).toInt();
 
-        return SingleChildScrollView(
-          padding: const EdgeInsets.all(24),
-          child: Column(
-            crossAxisAlignment: CrossAxisAlignment.start,
-            children: [
-              AspectRatio(
-                aspectRatio: 16 / 9,
-                child: ClipRRect(
-                  borderRadius: BorderRadius.circular(24),
-                  child: Card(
-                    clipBehavior: Clip.antiAlias,
-                    margin: EdgeInsets.zero,
-                    child: VaultUnityPanel(
-                      walletBalances: balancesForUnity,
-                      showLoader: walletState.isRefreshing || !unityReady,
-                      onUnityReady: onUnityReady,
-                      onCoinSelected: onCoinSelected,
-                    ),
-                  ),
-                ),
-              ),
-              if (selection != null)
-                Padding(
-                  padding: const EdgeInsets.only(top: 16),
-                  child: _SelectionBanner(selection: selection!),
-                ),
-              const SizedBox(height: 24),
-              Container(
-                padding: const EdgeInsets.all(24),
-                decoration: BoxDecoration(
-                  borderRadius: BorderRadius.circular(24),
-                  gradient: LinearGradient(
-                    colors: [
-                      theme.colorScheme.primary.withOpacity(0.1),
-                      theme.colorScheme.secondary.withOpacity(0.1),
-                    ],
-                    begin: Alignment.topLeft,
-                    end: Alignment.bottomRight,
-                  ),
-                ),
+        // Cards are square, so a viewport holds about this many of them.
+        final tileExtent =
+            (constraints.maxWidth - 48 - 16 * (crossAxisCount - 1)) /
+            crossAxisCount;
+        final perViewport =
+            crossAxisCount * (constraints.maxHeight / (tileExtent + 16)).ceil();
+
+        // Only the grid cells near the viewport are built; the header is one
+        // box so the Unity frame stays mounted while scrolled away.
+        return CustomScrollView(
+          slivers: [
+            SliverPadding(
+              padding: const EdgeInsets.fromLTRB(24, 24, 24, 16),
+              sliver: SliverToBoxAdapter(
                 child: Column(
                   crossAxisAlignment: CrossAxisAlignment.start,
                   children: [
-                    Text('Total Balance', style: theme.textTheme.titleMedium),
-                    const SizedBox(height: 12),
-                    Text(
-                      NumberFormat.simpleCurrency().format(
-                        wallet.totalUsdValue,
-                      ),
-                      style: theme.textTheme.displaySmall?.copyWith(
-                        fontWeight: FontWeight.bold,
+                    AspectRatio(
+                      aspectRatio: 16 / 9,
+                      child: ClipRRect(
+                        borderRadius: BorderRadius.circular(24),
+                        child: Card(
+                          clipBehavior: Clip.antiAlias,
+                          margin: EdgeInsets.zero,
+                          child: Stack(
+                            fit: StackFit.expand,
+                            children: [
+                              _UnityStage(
+                                unityReady: unityReady,
+                                onUnityReady: onUnityReady,
+                              ),
+                              const Positioned(
+                                top: 16,
+                                left: 16,
+                                child: _HoverTooltip(),
+                              ),
+                            ],
+                          ),
+                        ),
                       ),
                     ),
-                    const SizedBox(height: 12),
-                    Wrap(
-                      spacing: 12,
-                      runSpacing: 12,
-                      children: [
-                        Chip(
-                          avatar: const Icon(Icons.link),
-                          label: Text(_abbrAddress(wallet.address)),
-                        ),
-                        Chip(
-                          avatar: const Icon(Icons.language),
-                          label: Text('Chain ID: ${wallet.chainId}'),
+                    const _SelectionBanner(),
+                    const Padding(
+                      padding: EdgeInsets.only(top: 16),
+                      child: VaultFrameStatsChart(),
+                    ),
+                    const SizedBox(height: 24),
+                    Container(
+                      padding: const EdgeInsets.all(24),
+                      decoration: BoxDecoration(
+                        borderRadius: BorderRadius.circular(24),
+                        gradient: LinearGradient(
+                          colors: [
+                            theme.colorScheme.primary.withOpacity(0.1),
+                            theme.colorScheme.secondary.withOpacity(0.1),
+                          ],
+                          begin: Alignment.topLeft,
+                          end: Alignment.bottomRight,
                         ),
-                      ],
+                      ),
+                      child: Column(
+                        crossAxisAlignment: CrossAxisAlignment.start,
+                        children: [
+                          Text(
+                            'Total Balance',
+                            style: theme.textTheme.titleMedium,
+                          ),
+                          const SizedBox(height: 12),
+                          const _TotalBalance(),
+                          const SizedBox(height: 12),
+                          const _WalletChips(),
+                        ],
+                      ),
                     ),
+                    const SizedBox(height: 24),
+                    Text(
+                      'Vault Assets',
+                      style: theme.textTheme.titleLarge?.copyWith(
+                        fontWeight: FontWeight.bold,
+                      ),
+                    ),
+                    const SizedBox(height: 16),
+                    const _AssetGridToolbar(),
                   ],
                 ),
               ),
-              const SizedBox(height: 24),
-              Text(
-                'Vault Assets',
-                style: theme.textTheme.titleLarge?.copyWith(
-                  fontWeight: FontWeight.bold,
-                ),
-              ),
-              const SizedBox(height: 16),
-              GridView.builder(
-                physics: const NeverScrollableScrollPhysics(),
-                shrinkWrap: true,
-                gridDelegate: SliverGridDelegateWithFixedCrossAxisCount(
-                  crossAxisCount: crossAxisCount,
-                  crossAxisSpacing: 16,
-                  mainAxisSpacing: 16,
-                  childAspectRatio: 1,
-                ),
-                itemCount: wallet.assets.length,
-                itemBuilder: (context, index) {
-                  final asset = wallet.assets[index];
-                  return VaultAssetCard(asset: asset);
-                },
+            ),
+            SliverPadding(
+              padding: const EdgeInsets.fromLTRB(24, 0, 24, 24),
+              sliver: _AssetGrid(
+                crossAxisCount: crossAxisCount,
+                prefetchAhead: perViewport,
               ),
-            ],
-          ),
+            ),
+          ],
         );
       },
     );
   }
+}
+
+// Re-projects only when the coins change; price ticks keep the projection.
+class _UnityStage extends ConsumerWidget {
+  const _UnityStage({required this.unityReady, required this.onUnityReady});
+
+  final bool unityReady;
+  final ValueChanged<bool> onUnityReady;
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final unity = ref.watch(walletUnityProvider);
+    final isRefreshing = ref.watch(
+      walletStatusProvider.select((status) => status.isRefreshing),
+    );
+    return VaultUnityPanel(
+      wallet: unity,
+      showLoader: isRefreshing || !unityReady,
+      onUnityReady: onUnityReady,
+    );
+  }
+}
+
+class _TotalBalance extends ConsumerWidget {
+  const _TotalBalance();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final total = ref.watch(
+      walletProvider.select((wallet) => wallet?.totalUsdValue),
+    );
+    if (total == null) {
+      return const SizedBox.shrink();
+    }
+    return Text(
+      AssetDisplay.usd(total.toDouble()),
+      style: Theme.of(context).textTheme.displaySmall?.copyWith(
+        fontWeight: FontWeight.bold,
+      ),
+    );
+  }
+}
+
+class _WalletChips extends ConsumerWidget {
+  const _WalletChips();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    // Chain totals are only shown for multi-chain wallets; a single-chain
+    // price tick leaves this record equal.
+    final chips = ref.watch(
+      walletProvider.select(
+        (wallet) => wallet == null
+            ? null
+            : (
+                address: wallet.address,
+                chainId: wallet.chainId,
+                chains: wallet.isMultiChain ? wallet.chains : null,
+              ),
+      ),
+    );
+    if (chips == null) {
+      return const SizedBox.shrink();
+    }
+
+    final chains = chips.chains;
+    return Wrap(
+      spacing: 12,
+      runSpacing: 12,
+      children: [
+        Chip(
+          avatar: const Icon(Icons.link),
+          label: Text(_abbrAddress(chips.address)),
+        ),
+        if (chains != null)
+          for (final chain in chains)
+            Chip(
+              avatar: Icon(
+                chain.error == null ? Icons.language : Icons.error_outline,
+              ),
+              label: Text(_chainLabel(chain)),
+            )
+        else
+          Chip(
+            avatar: const Icon(Icons.language),
+            label: Text('Chain ID: ${chips.chainId}'),
+          ),
+      ],
+    );
+  }
 
   static String _abbrAddress(String address) {
     if (address.length <= 10) {
@@ -216,17 +345,142 @@ class _VaultContent extends StatelessWidget {
     }
     return '${address.substring(0, 6)}...${address.substring(address.length - 4)}';
   }
+
+  static String _chainLabel(ChainBreakdown chain) {
+    if (chain.error != null) {
+      return '${chain.name}: unavailable';
+    }
+    final value = AssetDisplay.usd(chain.usdValue.toDouble());
+    return '${chain.name} $value · ${chain.rpcLatency.inMilliseconds} ms';
+  }
+}
+
+class _AssetGridToolbar extends ConsumerWidget {
+  const _AssetGridToolbar();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final sort = ref.watch(assetGridProvider.select((query) => query.sort));
+    final grid = ref.read(assetGridProvider.notifier);
+    return Row(
+      children: [
+        Expanded(
+          child: TextField(
+            decoration: const InputDecoration(
+              isDense: true,
+              prefixIcon: Icon(Icons.search),
+              hintText: 'Filter by symbol or name',
+              border: OutlineInputBorder(),
+            ),
+            onChanged: grid.setFilter,
+          ),
+        ),
+        const SizedBox(width: 12),
+        PopupMenuButton<AssetSort>(
+          tooltip: 'Sort assets',
+          initialValue: sort,
+          onSelected: grid.setSort,
+          icon: const Icon(Icons.sort),
+          itemBuilder: (context) => const [
+            PopupMenuItem(value: AssetSort.wallet, child: Text('Wallet order')),
+            PopupMenuItem(value: AssetSort.value, child: Text('Highest value')),
+            PopupMenuItem(value: AssetSort.symbol, child: Text('Symbol A-Z')),
+          ],
+        ),
+      ],
+    );
+  }
 }
 
-class _SelectionBanner extends StatelessWidget {
-  const _SelectionBanner({required this.selection});
+// Rebuilds only when the shown keys change; each cell follows its own asset.
+// Cells are built lazily, and keyed so a reorder moves them instead of
+// rebuilding them.
+class _AssetGrid extends ConsumerWidget {
+  const _AssetGrid({required this.crossAxisCount, required this.prefetchAhead});
+
+  final int crossAxisCount;
 
-  final VaultCoinSelection selection;
+  /// How many cells past the one being built to start loading logos for,
+  /// about one viewport.
+  final int prefetchAhead;
 
   @override
-  Widget build(BuildContext context) {
+  Widget build(BuildContext context, WidgetRef ref) {
+    final keys = ref.watch(visibleAssetKeysProvider);
+    final indexOf = {for (var i = 0; i < keys.length; i++) keys[i]: i};
+    final logos = ref.read(assetLogoCacheProvider);
+
+    void prefetchLogo(BuildContext context, String key) {
+      final url = ref.read(walletAssetsByKeyProvider)[key]?.logoUrl;
+      if (url != null) {
+        logos.prefetch(context, url);
+      }
+    }
+
+    return SliverGrid(
+      gridDelegate: SliverGridDelegateWithFixedCrossAxisCount(
+        crossAxisCount: crossAxisCount,
+        crossAxisSpacing: 16,
+        mainAxisSpacing: 16,
+        childAspectRatio: 1,
+      ),
+      delegate: SliverChildBuilderDelegate(
+        (context, index) {
+          final ahead = index + prefetchAhead;
+          if (ahead < keys.length) {
+            prefetchLogo(context, keys[ahead]);
+          }
+          return _AssetCell(key: ValueKey(keys[index]), assetKey: keys[index]);
+        },
+        childCount: keys.length,
+        findChildIndexCallback: (key) =>
+            indexOf[(key as ValueKey<String>).value],
+        addAutomaticKeepAlives: false,
+      ),
+    );
+  }
+}
+
+class _AssetCell extends ConsumerWidget {
+  const _AssetCell({super.key, required this.assetKey});
+
+  final String assetKey;
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final asset = ref.watch(walletAssetProvider(assetKey));
+    if (asset == null) {
+      return const SizedBox.shrink();
+    }
+    final display = AssetDisplay.of(asset);
+    final url = display.logoUrl;
+    return VaultAssetCard(
+      asset: display,
+      logo: url == null
+          ? null
+          : ref
+              .read(assetLogoCacheProvider)
+              .imageFor(url, MediaQuery.devicePixelRatioOf(context)),
+    );
+  }
+}
+
+// Watches only the selected coin, so hover and focus updates streamed from
+// Unity never rebuild the banner, and selections never rebuild VaultView.
+class _SelectionBanner extends ConsumerWidget {
+  const _SelectionBanner();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final selection = ref.watch(
+      vaultInteractionProvider.select((state) => state.selected),
+    );
+    if (selection == null) {
+      return const SizedBox.shrink();
+    }
+
     final theme = Theme.of(context);
-    return Card(
+    final banner = Card(
       elevation: 0,
       color: theme.colorScheme.primary.withOpacity(0.1),
       shape: RoundedRectangleBorder(borderRadius: BorderRadius.circular(18)),
@@ -247,6 +501,38 @@ class _SelectionBanner extends StatelessWidget {
         ),
       ),
     );
+    return Padding(padding: const EdgeInsets.only(top: 16), child: banner);
+  }
+}
+
+class _HoverTooltip extends ConsumerWidget {
+  const _HoverTooltip();
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final hovered = ref.watch(
+      vaultInteractionProvider.select((state) => state.hovered),
+    );
+    if (hovered == null) {
+      return const SizedBox.shrink();
+    }
+
+    final theme = Theme.of(context);
+    return IgnorePointer(
+      child: DecoratedBox(
+        decoration: BoxDecoration(
+          color: Colors.black.withOpacity(0.7),
+          borderRadius: BorderRadius.circular(12),
+        ),
+        child: Padding(
+          padding: const EdgeInsets.symmetric(horizontal: 12, vertical: 8),
+          child: Text(
+            '${hovered.symbol}  x${hovered.countPerCoin}',
+            style: theme.textTheme.labelLarge?.copyWith(color: Colors.white),
+          ),
+        ),
+      ),
+    );
   }
 }
 
@@ -0,0 +1,46 @@
+import 'dart:collection';
+
+import 'package:flutter/widgets.dart';
+
+/// Token logos for the asset grid, decoded at the size they are drawn.
+///
+/// Logos are often 200px or larger; decoding them at [logicalSize] keeps a
+/// few thousand of them within the [ImageCache] budget. Images stay in the
+/// shared [ImageCache]; on the web the browser's HTTP cache keeps them on
+/// disk.
+class AssetLogoCache {
+  AssetLogoCache({this.logicalSize = 40, this.maxPrefetched = 1000});
+
+  /// Logo edge length in logical pixels.
+  final double logicalSize;
+
+  /// How many prefetched URLs are remembered to avoid requesting them twice.
+  final int maxPrefetched;
+
+  final LinkedHashSet<String> _prefetched = LinkedHashSet();
+
+  ImageProvider imageFor(String url, double devicePixelRatio) {
+    final pixels = (logicalSize * devicePixelRatio).ceil();
+    return ResizeImage(
+      NetworkImage(url),
+      width: pixels,
+      height: pixels,
+      policy: ResizeImagePolicy.fit,
+    );
+  }
+
+  /// Starts loading [url] so its card shows the logo when scrolled in.
+  void prefetch(BuildContext context, String url) {
+    if (!_prefetched.add(url)) {
+      return;
+    }
+    if (_prefetched.length > maxPrefetched) {
+      _prefetched.remove(_prefetched.first);
+    }
+    precacheImage(
+      imageFor(url, MediaQuery.devicePixelRatioOf(context)),
+      context,
+      onError: (_, __) {},
+    );
+  }
+}
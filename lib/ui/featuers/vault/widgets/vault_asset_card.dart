@@ -1,17 +1,19 @@
 import 'package:flutter/material.dart';
-import 'package:intl/intl.dart';
 
-import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/asset_display.dart';
 
 class VaultAssetCard extends StatelessWidget {
-  const VaultAssetCard({super.key, required this.asset});
+  const VaultAssetCard({super.key, required this.asset, this.logo});
 
-  final CryptoAsset asset;
+  final AssetDisplay asset;
+
+  /// The asset's logo, sized by AssetLogoCache; the initial is shown when
+  /// null.
+  final ImageProvider? logo;
 
   @override
   Widget build(BuildContext context) {
     final theme = Theme.of(context);
-    final numberFormat = NumberFormat('#,##0.####');
 
     return Container(
       padding: const EdgeInsets.all(16),
@@ -28,12 +30,11 @@ class VaultAssetCard extends StatelessWidget {
               CircleAvatar(
                 radius: 20,
                 backgroundColor: theme.colorScheme.primary.withOpacity(0.2),
-                backgroundImage: asset.logoUrl != null
-                    ? NetworkImage(asset.logoUrl!)
-                    : null,
-                child: asset.logoUrl == null
+                backgroundImage: logo,
+                onBackgroundImageError: logo == null ? null : (_, __) {},
+                child: logo == null
                     ? Text(
-                        asset.symbol.substring(0, 1),
+                        asset.initial,
                         style: theme.textTheme.titleMedium?.copyWith(
                           fontWeight: FontWeight.bold,
                         ),
@@ -64,14 +65,14 @@ class VaultAssetCard extends StatelessWidget {
           ),
           const Spacer(),
           Text(
-            numberFormat.format(asset.normalizedBalance),
+            asset.balance,
             style: theme.textTheme.headlineSmall?.copyWith(
               fontWeight: FontWeight.w600,
             ),
           ),
           const SizedBox(height: 8),
           Text(
-            NumberFormat.simpleCurrency().format(asset.usdValue),
+            asset.usdValue,
             style: theme.textTheme.bodyMedium?.copyWith(
               color: theme.colorScheme.primary,
             ),
@@ -0,0 +1,32 @@
+/// A coin in the Unity vault, as reported by the selection event ring.
+class VaultCoinSelection {
+  const VaultCoinSelection({
+    required this.symbol,
+    required this.countPerCoin,
+    this.tier = 0,
+    this.coinIndex = 0,
+  });
+
+  final String symbol;
+  final int countPerCoin;
+
+  /// Power of ten each full coin of this stack stands for.
+  final int tier;
+
+  /// Position of the coin within its symbol's stack.
+  final int coinIndex;
+
+  bool isSameCoin(VaultCoinSelection other) =>
+      symbol == other.symbol && coinIndex == other.coinIndex;
+
+  @override
+  bool operator ==(Object other) =>
+      other is VaultCoinSelection &&
+      other.symbol == symbol &&
+      other.countPerCoin == countPerCoin &&
+      other.tier == tier &&
+      other.coinIndex == coinIndex;
+
+  @override
+  int get hashCode => Object.hash(symbol, countPerCoin, tier, coinIndex);
+}
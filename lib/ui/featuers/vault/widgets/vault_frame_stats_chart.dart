@@ -0,0 +1,149 @@
+import 'dart:math' as math;
+
+import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/vault_frame_stats_view_model.dart';
+
+/// Charts p50/p95 frame time reported by the Unity vault, with the latest
+/// breakdown underneath. Hidden until the first report arrives.
+class VaultFrameStatsChart extends ConsumerWidget {
+  const VaultFrameStatsChart({super.key});
+
+  @override
+  Widget build(BuildContext context, WidgetRef ref) {
+    final history = ref.watch(vaultFrameStatsProvider);
+    if (history.isEmpty) {
+      return const SizedBox.shrink();
+    }
+
+    final theme = Theme.of(context);
+    final latest = history.last;
+    final p50Color = theme.colorScheme.primary;
+    final p95Color = theme.colorScheme.tertiary;
+
+    return Card(
+      elevation: 0,
+      color: theme.colorScheme.surfaceVariant.withOpacity(0.6),
+      shape: RoundedRectangleBorder(borderRadius: BorderRadius.circular(18)),
+      child: Padding(
+        padding: const EdgeInsets.all(16),
+        child: Column(
+          crossAxisAlignment: CrossAxisAlignment.start,
+          children: [
+            Text(
+              'Frame time  p50 ${latest.frameP50.toStringAsFixed(1)} ms  '
+              'p95 ${latest.frameP95.toStringAsFixed(1)} ms',
+              style: theme.textTheme.titleSmall,
+            ),
+            const SizedBox(height: 12),
+            SizedBox(
+              height: 80,
+              child: CustomPaint(
+                size: Size.infinite,
+                painter: _FrameTimePainter(
+                  history: history,
+                  p50Color: p50Color,
+                  p95Color: p95Color,
+                  gridColor: theme.colorScheme.outline.withOpacity(0.3),
+                ),
+              ),
+            ),
+            const SizedBox(height: 12),
+            Text(
+              'main p95 ${latest.mainP95.toStringAsFixed(1)} ms · '
+              'physics p95 ${latest.physicsP95.toStringAsFixed(1)} ms · '
+              'render p95 ${latest.renderP95.toStringAsFixed(1)} ms · '
+              'GC ${(latest.gcAllocBytes / 1024).toStringAsFixed(0)} KB · '
+              '${latest.coins} coins · ${latest.batches} batches '
+              '(${latest.instancedBatches} instanced)',
+              style: theme.textTheme.bodySmall,
+            ),
+            Text(
+              '${latest.logoTextures} logos (${latest.logoFormat}) '
+              '${(latest.logoBytes / 1024).toStringAsFixed(0)} KB · '
+              'decode max ${latest.logoDecodeMsMax.toStringAsFixed(1)} ms',
+              style: theme.textTheme.bodySmall,
+            ),
+            Text(
+              '${(latest.coinTriangles / 1000).toStringAsFixed(0)}k coin tris · '
+              '${latest.coinsReduced} reduced · '
+              '${latest.coinsImpostor} impostor · '
+              '${latest.coinsHidden} buried',
+              style: theme.textTheme.bodySmall,
+            ),
+          ],
+        ),
+      ),
+    );
+  }
+}
+
+class _FrameTimePainter extends CustomPainter {
+  _FrameTimePainter({
+    required this.history,
+    required this.p50Color,
+    required this.p95Color,
+    required this.gridColor,
+  });
+
+  final List<VaultFrameStats> history;
+  final Color p50Color;
+  final Color p95Color;
+  final Color gridColor;
+
+  // 16.7 ms (60 fps) and 33.3 ms (30 fps) budget lines.
+  static const List<double> _budgetsMs = [1000 / 60, 1000 / 30];
+
+  @override
+  void paint(Canvas canvas, Size size) {
+    final peak = history.fold<double>(
+      _budgetsMs.first,
+      (value, stats) => math.max(value, stats.frameP95),
+    );
+    final maxMs = peak * 1.1;
+    double y(double ms) => size.height - (ms / maxMs).clamp(0, 1) * size.height;
+
+    final grid = Paint()
+      ..color = gridColor
+      ..strokeWidth = 1;
+    for (final budget in _budgetsMs) {
+      if (budget <= maxMs) {
+        canvas.drawLine(Offset(0, y(budget)), Offset(size.width, y(budget)), grid);
+      }
+    }
+
+    final step = size.width /
+        math.max(1, VaultFrameStatsViewModel.historyLength - 1);
+    final start = size.width - step * (history.length - 1);
+
+    void drawSeries(double Function(VaultFrameStats) value, Color color) {
+      final path = Path();
+      for (var i = 0; i < history.length; i++) {
+        final point = Offset(start + step * i, y(value(history[i])));
+        if (i == 0) {
+          path.moveTo(point.dx, point.dy);
+        } else {
+          path.lineTo(point.dx, point.dy);
+        }
+      }
+      canvas.drawPath(
+        path,
+        Paint()
+          ..color = color
+          ..style = PaintingStyle.stroke
+          ..strokeWidth = 2,
+      );
+    }
+
+    drawSeries((stats) => stats.frameP95, p95Color);
+    drawSeries((stats) => stats.frameP50, p50Color);
+  }
+
+  @override
+  bool shouldRepaint(covariant _FrameTimePainter oldDelegate) =>
+      !identical(oldDelegate.history, history) ||
+      oldDelegate.p50Color != p50Color ||
+      oldDelegate.p95Color != p95Color;
+}
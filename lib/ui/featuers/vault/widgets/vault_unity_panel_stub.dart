@@ -1,22 +1,21 @@
 import 'package:flutter/material.dart';
 
-class VaultCoinSelection {
-  const VaultCoinSelection({required this.symbol, required this.countPerCoin});
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/unity_wallet_projection.dart';
 
-  final String symbol;
-  final int countPerCoin;
-}
+import 'vault_coin_selection.dart';
+
+export 'vault_coin_selection.dart';
 
 class VaultUnityPanel extends StatelessWidget {
   const VaultUnityPanel({
     super.key,
-    required this.walletBalances,
-    required this.onCoinSelected,
+    required this.wallet,
+    this.onCoinSelected,
     required this.showLoader,
     required this.onUnityReady,
   });
 
-  final List<Map<String, dynamic>> walletBalances;
+  final UnityWalletProjection wallet;
   final ValueChanged<VaultCoinSelection>? onCoinSelected;
   final bool showLoader;
   final ValueChanged<bool>? onUnityReady;
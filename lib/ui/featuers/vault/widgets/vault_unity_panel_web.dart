@@ -1,59 +1,106 @@
 import 'dart:async';
 import 'dart:convert';
+import 'dart:math' as math;
 // ignore: avoid_web_libraries_in_flutter
 import 'dart:html' as html;
-import 'dart:ui_web' as ui_web;
 
 import 'package:flutter/foundation.dart';
 import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:js/js.dart' as js;
+import 'package:js/js_util.dart' as js_util;
 
-class VaultCoinSelection {
-  const VaultCoinSelection({required this.symbol, required this.countPerCoin});
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/unity_wallet_projection.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/vault_frame_stats_view_model.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/vault_interaction_view_model.dart';
 
-  final String symbol;
-  final int countPerCoin;
-}
+import 'vault_coin_selection.dart';
+
+export 'vault_coin_selection.dart';
 
-class VaultUnityPanel extends StatefulWidget {
+class VaultUnityPanel extends ConsumerStatefulWidget {
   const VaultUnityPanel({
     super.key,
-    required this.walletBalances,
-    required this.onCoinSelected,
+    required this.wallet,
+    this.onCoinSelected,
     required this.showLoader,
     required this.onUnityReady,
   });
 
-  final List<Map<String, dynamic>> walletBalances;
+  final UnityWalletProjection wallet;
   final ValueChanged<VaultCoinSelection>? onCoinSelected;
   final bool showLoader;
   final ValueChanged<bool>? onUnityReady;
 
   @override
-  State<VaultUnityPanel> createState() => _VaultUnityPanelState();
+  ConsumerState<VaultUnityPanel> createState() => _VaultUnityPanelState();
 }
 
-class _VaultUnityPanelState extends State<VaultUnityPanel> {
-  static int _viewIdSeed = 0;
+class _VaultUnityPanelState extends ConsumerState<VaultUnityPanel> {
+  // `?vaultTransport=window` keeps the window.postMessage path, for comparing
+  // bridge latency against the MessageChannel port.
+  static final bool _useMessageChannel =
+      Uri.base.queryParameters['vaultTransport'] != 'window';
+
+  // Player diagnostics forwarded from the app URL: `?vaultHud=1` turns on the
+  // in-scene perf overlay (PerfSampler.cs), `?vaultRecord=1` records bridge
+  // traffic (bridge_recorder.js), and `?vaultReplay=<url>` with an optional
+  // `vaultReplaySpeed` replays a recording into the player (BridgeReplay.cs).
+  static const Map<String, String> _playerParameters = {
+    'vaultHud': 'hud',
+    'vaultRecord': 'record',
+    'vaultReplay': 'replay',
+    'vaultReplaySpeed': 'replaySpeed',
+  };
+
+  static final String _playerUrl = () {
+    final host = Uri.base.queryParameters;
+    final query = <String, String>{
+      for (final entry in _playerParameters.entries)
+        if (host[entry.key] != null) entry.value: host[entry.key]!,
+    };
+    return Uri(
+      path: '/3d/index.html',
+      queryParameters: query.isEmpty ? null : query,
+    ).toString();
+  }();
+
+  // Slot layout from SelectionEventBuffer.cs:
+  // kind, symbolId, countPerCoin, tier, coinIndex, frame.
+  static const int _selectedEventKind = 1;
+  static const int _hoverEnterEventKind = 2;
+  static const int _hoverExitEventKind = 3;
+  static const int _cameraFocusEventKind = 4;
 
-  late final String _viewType;
   html.IFrameElement? _iframe;
   StreamSubscription<html.Event>? _messageSub;
+  html.MessagePort? _port;
+  StreamSubscription<html.MessageEvent>? _portSub;
+  UnityWalletProjection _sentWallet = UnityWalletProjection.empty;
+  int _selectionCursor = 0;
   bool _frameLoaded = false;
-  String? _lastWalletPayload;
+  bool _routeActive = true;
 
   @override
   void initState() {
     super.initState();
     assert(kIsWeb, 'VaultUnityPanel_web is only for web builds.');
-    _viewType = 'unity-vault-frame-${_viewIdSeed++}';
-    ui_web.platformViewRegistry.registerViewFactory(_viewType, _createIFrame);
     _messageSub = html.window.onMessage.listen(_handleMessageEvent);
+    js_util.setProperty(
+      html.window,
+      'UnityVaultSelectionSink',
+      js.allowInterop(_drainSelectionEvents),
+    );
   }
 
-  html.Element _createIFrame(int viewId) {
-    final element = html.IFrameElement()
-      ..id = 'unity-vault-frame-$viewId'
-      ..src = '/3d/index.html'
+  // The panel lives inside the vault shell branch, which GoRouter keeps mounted
+  // across navigation, so this element (and the Unity instance inside it) is
+  // created once per session rather than once per visit.
+  void _configureIFrame(Object created) {
+    final element = (created as html.IFrameElement)
+      ..id = 'unity-vault-frame'
+      ..src = _playerUrl
       ..style.border = '0'
       ..style.width = '100%'
       ..style.height = '100%'
@@ -61,14 +108,33 @@ class _VaultUnityPanelState extends State<VaultUnityPanel> {
       ..allow = 'autoplay; fullscreen; xr-spatial-tracking';
 
     element.onLoad.listen((_) {
+      if (!mounted) {
+        return;
+      }
       _frameLoaded = true;
+      ref.read(vaultInteractionProvider.notifier).clear();
       widget.onUnityReady?.call(true);
+      _connectPort();
+      _postVisibility();
+      // A (re)loaded player starts without coins.
+      _sentWallet = UnityWalletProjection.empty;
       _postWallet();
       setState(() {});
     });
 
     _iframe = element;
-    return element;
+  }
+
+  @override
+  void didChangeDependencies() {
+    super.didChangeDependencies();
+    // TickerMode is disabled while the route is covered or offstage, which is
+    // exactly when the Unity main loop should be suspended.
+    final routeActive = TickerMode.of(context);
+    if (routeActive != _routeActive) {
+      _routeActive = routeActive;
+      _postVisibility();
+    }
   }
 
   @override
@@ -82,63 +148,199 @@ class _VaultUnityPanelState extends State<VaultUnityPanel> {
     widget.onUnityReady?.call(false);
     _messageSub?.cancel();
     _messageSub = null;
+    _closePort();
+    js_util.setProperty(html.window, 'UnityVaultSelectionSink', null);
     super.dispose();
   }
 
+  // A fresh document in the frame needs a fresh channel; the old port is
+  // closed so a reloaded player never receives duplicates.
+  void _connectPort() {
+    _closePort();
+    _selectionCursor = 0;
+    final window = _iframe?.contentWindow;
+    if (!_useMessageChannel || window == null) {
+      return;
+    }
+
+    final channel = html.MessageChannel();
+    _portSub = channel.port1.onMessage.listen(
+      (event) => _handleUnityEnvelope(event.data, 'port'),
+    );
+    channel.port1.start();
+    window.postMessage({'type': 'connectPort'}, '*', [channel.port2]);
+    _port = channel.port1;
+  }
+
+  void _closePort() {
+    _portSub?.cancel();
+    _portSub = null;
+    _port?.close();
+    _port = null;
+  }
+
+  void _send(Map<String, Object?> message) {
+    final port = _port;
+    if (port != null) {
+      port.postMessage(message);
+      return;
+    }
+    _iframe?.contentWindow?.postMessage(message, '*');
+  }
+
+  void _sampleLatency(String name, Object? sentAt) {
+    if (sentAt is! num) {
+      return;
+    }
+    final timeline = js_util.getProperty<Object?>(
+      html.window,
+      'UnityVaultTimeline',
+    );
+    if (timeline == null) {
+      return;
+    }
+    final elapsed = html.window.performance.now() - sentAt;
+    js_util.callMethod<void>(timeline, 'sample', [name, elapsed]);
+  }
+
   void _postWallet() {
     if (!_frameLoaded) {
       return;
     }
 
-    final window = _iframe?.contentWindow;
-    if (window == null) {
+    final wallet = widget.wallet;
+    if (wallet.version == _sentWallet.version) {
+      return;
+    }
+
+    // A refresh that returns the same balances is a new version with an equal
+    // payload; the player would only respawn the same coins.
+    final unchanged = wallet.payload == _sentWallet.payload;
+    _sentWallet = wallet;
+    if (unchanged) {
       return;
     }
 
-    final payloadMap = {
+    // The payload stays a JSON string end to end: the frame hands it to Unity
+    // as-is instead of re-serializing a structured-cloned map.
+    _send({
       'type': 'setWallet',
-      'balances': widget.walletBalances,
-    };
-    final payload = jsonEncode(payloadMap);
+      'payload': wallet.payload,
+      'sentAt': html.window.performance.now(),
+    });
+  }
 
-    if (payload == _lastWalletPayload) {
+  void _postVisibility() {
+    if (!_frameLoaded) {
       return;
     }
 
-    _lastWalletPayload = payload;
-    window.postMessage(payload, '*');
+    _send({'type': 'setVisibility', 'visible': _routeActive});
   }
 
   void _handleMessageEvent(html.Event event) {
-    if (event is! html.MessageEvent) {
+    if (event is! html.MessageEvent || _port != null) {
+      return;
+    }
+    _handleUnityEnvelope(event.data, 'window');
+  }
+
+  // Unity replies with {payload: <json string>, sentAt: <host ms>}. Coin
+  // selections do not take this path; they arrive through the selection ring
+  // below.
+  void _handleUnityEnvelope(Object? data, String transport) {
+    if (data is! Map) {
+      return;
+    }
+
+    final payload = data['payload'];
+    if (payload is! String) {
       return;
     }
 
-    final data = event.data;
     dynamic message;
-    if (data is String) {
-      try {
-        message = jsonDecode(data);
-      } catch (_) {
-        message = null;
-      }
-    } else if (data is Map) {
-      message = data;
+    try {
+      message = jsonDecode(payload);
+    } catch (_) {
+      message = null;
     }
 
     if (message is! Map) {
       return;
     }
 
-    if (message['type'] != 'coinSelected') {
-      return;
+    _sampleLatency('${message['type']}:$transport', data['sentAt']);
+    if (message['type'] == 'frameStats') {
+      ref
+          .read(vaultFrameStatsProvider.notifier)
+          .add(VaultFrameStats.fromJson(message));
     }
+  }
 
-    final symbol = (message['symbol'] as String?) ?? '';
-    final count = (message['count_per_coin'] as num?)?.toInt() ?? 0;
-    widget.onCoinSelected?.call(
-      VaultCoinSelection(symbol: symbol, countPerCoin: count),
-    );
+  // Called from WebGLBridge.jslib once per Unity frame with new events. The
+  // ring is a view over the wasm heap, so reading it involves no JSON and no
+  // per-event objects on the Unity side. The whole batch lands in Riverpod as
+  // one state change, so only widgets watching the affected field rebuild.
+  void _drainSelectionEvents(Object ring) {
+    final sequence = js_util.getProperty<int>(ring, 'sequence');
+    final view = js_util.getProperty<Object>(ring, 'view');
+    final base = js_util.getProperty<int>(ring, 'base');
+    final capacity = js_util.getProperty<int>(ring, 'capacity');
+    final stride = js_util.getProperty<int>(ring, 'stride');
+
+    // Events older than one lap have been overwritten.
+    var cursor = math.max(_selectionCursor, sequence - capacity);
+    _selectionCursor = sequence;
+    int field(int slot, int index) =>
+        js_util.getProperty<int>(view, slot + index);
+
+    final current = ref.read(vaultInteractionProvider);
+    var hovered = current.hovered;
+    var selected = current.selected;
+    var focused = current.focused;
+    VaultCoinSelection? selectedThisFrame;
+
+    for (; cursor < sequence; cursor++) {
+      final slot = base + (cursor % capacity) * stride;
+      final symbolId = field(slot, 1);
+      final balances = _sentWallet.balances;
+      final coin = symbolId >= 0 && symbolId < balances.length
+          ? VaultCoinSelection(
+              symbol: (balances[symbolId]['symbol'] as String? ?? '')
+                  .toUpperCase(),
+              countPerCoin: field(slot, 2),
+              tier: field(slot, 3),
+              coinIndex: field(slot, 4),
+            )
+          : null;
+
+      switch (field(slot, 0)) {
+        case _selectedEventKind:
+          selected = coin;
+          selectedThisFrame = coin;
+        case _hoverEnterEventKind:
+          hovered = coin;
+        case _hoverExitEventKind:
+          if (hovered != null && (coin == null || hovered.isSameCoin(coin))) {
+            hovered = null;
+          }
+        case _cameraFocusEventKind:
+          focused = coin;
+      }
+    }
+
+    ref
+        .read(vaultInteractionProvider.notifier)
+        .applyFrame(
+          VaultInteractionState(
+            hovered: hovered,
+            selected: selected,
+            focused: focused,
+          ),
+        );
+    if (selectedThisFrame != null) {
+      widget.onCoinSelected?.call(selectedThisFrame);
+    }
   }
 
   @override
@@ -146,7 +348,10 @@ class _VaultUnityPanelState extends State<VaultUnityPanel> {
     return Stack(
       fit: StackFit.expand,
       children: [
-        HtmlElementView(viewType: _viewType),
+        HtmlElementView.fromTagName(
+          tagName: 'iframe',
+          onElementCreated: _configureIFrame,
+        ),
         if (widget.showLoader || !_frameLoaded)
           Container(
             color: Colors.black.withOpacity(0.65),
@@ -0,0 +1,2 @@
+export 'vault_unity_prefetcher_stub.dart'
+    if (dart.library.html) 'vault_unity_prefetcher_web.dart';
@@ -0,0 +1,10 @@
+import 'package:flutter/widgets.dart';
+
+class VaultUnityPrefetcher extends StatelessWidget {
+  const VaultUnityPrefetcher({super.key, required this.child});
+
+  final Widget child;
+
+  @override
+  Widget build(BuildContext context) => child;
+}
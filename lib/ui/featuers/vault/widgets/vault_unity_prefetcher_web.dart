@@ -0,0 +1,51 @@
+// ignore: avoid_web_libraries_in_flutter
+import 'dart:html' as html;
+
+import 'package:flutter/foundation.dart';
+import 'package:flutter/widgets.dart';
+import 'package:js/js_util.dart' as js_util;
+
+/// Starts the background download and wasm compile of the Unity vault build
+/// (see `web/3d/prefetch.js`) once [child] has painted and is visible.
+class VaultUnityPrefetcher extends StatefulWidget {
+  const VaultUnityPrefetcher({super.key, required this.child});
+
+  final Widget child;
+
+  @override
+  State<VaultUnityPrefetcher> createState() => _VaultUnityPrefetcherState();
+}
+
+class _VaultUnityPrefetcherState extends State<VaultUnityPrefetcher> {
+  bool _scheduled = false;
+
+  @override
+  void didChangeDependencies() {
+    super.didChangeDependencies();
+    if (_scheduled || !TickerMode.of(context)) {
+      return;
+    }
+
+    _scheduled = true;
+    WidgetsBinding.instance.addPostFrameCallback((_) => _startPrefetch());
+  }
+
+  void _startPrefetch() {
+    try {
+      final prefetch = js_util.getProperty<Object?>(
+        html.window,
+        'UnityVaultPrefetch',
+      );
+      if (prefetch == null) {
+        debugPrint('[VaultPrefetch] prefetch.js not loaded; skipping');
+        return;
+      }
+      js_util.callMethod<void>(prefetch, 'start', const []);
+    } catch (error) {
+      debugPrint('[VaultPrefetch] start failed: ' + error.toString());
+    }
+  }
+
+  @override
+  Widget build(BuildContext context) => widget.child;
+}
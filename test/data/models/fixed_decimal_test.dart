@@ -0,0 +1,64 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+
+void main() {
+  group('FixedDecimal', () {
+    test('parses plain and exponent forms', () {
+      expect(FixedDecimal.parse('-12.50').toString(), '-12.50');
+      expect(FixedDecimal.parse('1.2e-7').toString(), '0.00000012');
+      expect(FixedDecimal.parse('3e2').toString(), '300');
+      expect(() => FixedDecimal.parse('.'), throwsFormatException);
+    });
+
+    test('converts 18-decimal balances beyond 2^53 units', () {
+      final amount = FixedDecimal(BigInt.parse('123456789012345678901234'), 18);
+      expect(amount.toString(), '123456.789012345678901234');
+      expect(amount.toDouble(), closeTo(123456.789012345678, 1e-9));
+    });
+
+    test('rounds products with the requested mode', () {
+      final half = FixedDecimal.parse('0.125');
+      final one = FixedDecimal.fromInt(1);
+      expect(half.multiply(one, scale: 2).toString(), '0.12');
+      expect(
+        half.multiply(one, scale: 2, rounding: DecimalRounding.halfUp).toString(),
+        '0.13',
+      );
+      expect(
+        (-half).multiply(one, scale: 2, rounding: DecimalRounding.halfUp).toString(),
+        '-0.13',
+      );
+      expect(
+        FixedDecimal.parse('0.129')
+            .multiply(one, scale: 2, rounding: DecimalRounding.down)
+            .toString(),
+        '0.12',
+      );
+    });
+
+    test('compares and adds across scales', () {
+      expect(FixedDecimal.parse('1.50'), FixedDecimal.parse('1.5'));
+      expect(
+        FixedDecimal.parse('1.50').hashCode,
+        FixedDecimal.parse('1.5').hashCode,
+      );
+      expect(
+        (FixedDecimal.parse('0.1') + FixedDecimal.parse('0.02')).toString(),
+        '0.12',
+      );
+      expect(FixedDecimal.parse('2').compareTo(FixedDecimal.parse('1.99')), 1);
+    });
+  });
+
+  test('CryptoAsset values balances exactly to the cent', () {
+    // 0.1 + 0.2 style inputs that drift as doubles.
+    final amount = FixedDecimal(BigInt.from(300000), 6);
+    final value = CryptoAsset.valueAt(amount, 0.1);
+    expect(value.toString(), '0.03');
+
+    final whale = FixedDecimal(BigInt.parse('987654321987654321987654321'), 18);
+    expect(CryptoAsset.valueAt(whale, 1.0).toString(), '987654321.99');
+  });
+}
@@ -0,0 +1,317 @@
+import 'dart:async';
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/balance_tracker.dart';
+import 'package:crypto_treasury/data/services/json_rpc_client.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+import '../../support/loopback_server.dart';
+
+const _owner = '0x00000000000000000000000000000000000000aa';
+const _other = '0x00000000000000000000000000000000000000bb';
+const _usdc = '0x00000000000000000000000000000000000000c1';
+const _dai = '0x00000000000000000000000000000000000000d1';
+const _unlisted = '0x00000000000000000000000000000000000000e1';
+
+final _registry = TokenRegistry.fromTokens(const [
+  TrackedToken(
+    chainId: 1,
+    address: _usdc,
+    symbol: 'USDC',
+    name: 'USD Coin',
+    decimals: 6,
+  ),
+  TrackedToken(
+    chainId: 1,
+    address: _dai,
+    symbol: 'DAI',
+    name: 'Dai Stablecoin',
+    decimals: 18,
+  ),
+]);
+
+/// A dev-chain stand-in: blocks, balances and Transfer logs served over
+/// batched JSON-RPC.
+class _FakeDevChain {
+  static Future<_FakeDevChain> start() async {
+    final chain = _FakeDevChain();
+    chain._server = await LoopbackServer.start(chain._handle);
+    return chain;
+  }
+
+  late final LoopbackServer _server;
+  int head = 100;
+  BigInt native = BigInt.parse('2000000000000000000');
+  final Map<String, BigInt> balances = {_usdc: BigInt.from(5000000)};
+  final List<Map<String, Object?>> _logs = [];
+
+  /// Answers the owner's incoming-transfer filter with an error, as a node
+  /// rate-limiting `eth_getLogs` would.
+  bool failIncomingLogs = false;
+
+  /// Methods of each HTTP request, one list per round trip.
+  final List<List<String>> requests = [];
+
+  Uri get uri => _server.uri();
+
+  Future<void> close() => _server.close();
+
+  void mine() => head++;
+
+  /// Mines a block with one Transfer and updates the owner's balance.
+  void transfer(
+    String token, {
+    required String from,
+    required String to,
+    required int value,
+  }) {
+    head++;
+    _logs.add({
+      'address': token,
+      'blockNumber': _hex(head),
+      'transactionHash': '0x${_logs.length.toRadixString(16).padLeft(64, '0')}',
+      'logIndex': '0x0',
+      'topics': [
+        JsonRpcRequest.transferTopic,
+        JsonRpcRequest.addressTopic(from),
+        JsonRpcRequest.addressTopic(to),
+      ],
+      'data': '0x${value.toRadixString(16).padLeft(64, '0')}',
+    });
+    final delta = BigInt.from(value);
+    final balance = balances[token] ?? BigInt.zero;
+    if (to == _owner) {
+      balances[token] = balance + delta;
+    }
+    if (from == _owner) {
+      balances[token] = (balances[token] ?? BigInt.zero) - delta;
+    }
+  }
+
+  Future<void> _handle(HttpRequest request) async {
+    final calls = await readJsonRpcBatch(request);
+    requests.add([for (final call in calls) call['method'] as String]);
+    await writeJsonRpcBatch(request, calls, _answer);
+  }
+
+  Object? _answer(Map<String, dynamic> call) {
+    final params = call['params'] as List;
+    switch (call['method']) {
+      case 'eth_blockNumber':
+        return _hex(head);
+      case 'eth_getBalance':
+        return '0x${native.toRadixString(16)}';
+      case 'eth_call':
+        final token = (params.first as Map)['to'] as String;
+        return '0x${(balances[token] ?? BigInt.zero).toRadixString(16)}';
+      case 'eth_getLogs':
+        final filter = params.first as Map;
+        if (failIncomingLogs && (filter['topics'] as List).length == 3) {
+          return const JsonRpcErrorAnswer(-32005, 'rate limited');
+        }
+        final from = _parse(filter['fromBlock']);
+        final to = _parse(filter['toBlock']);
+        final topics = filter['topics'] as List;
+        return [
+          for (final log in _logs)
+            if (_parse(log['blockNumber']) >= from &&
+                _parse(log['blockNumber']) <= to &&
+                _matches(log['topics'] as List, topics))
+              log,
+        ];
+    }
+    return null;
+  }
+
+  static bool _matches(List<Object?> topics, List<Object?> filter) {
+    for (var i = 0; i < filter.length; i++) {
+      if (filter[i] != null && filter[i] != topics[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static String _hex(int value) => '0x${value.toRadixString(16)}';
+
+  static int _parse(Object? hex) =>
+      int.parse((hex as String).substring(2), radix: 16);
+}
+
+CryptoWallet _wallet() => CryptoWallet(
+  address: _owner,
+  chainId: 1,
+  assets: [
+    CryptoAsset(
+      symbol: 'ETH',
+      name: 'Ethereum Native',
+      amount: FixedDecimal(BigInt.parse('2000000000000000000'), 18),
+      logoUrl: null,
+      usdValue: FixedDecimal.parse('4000.00'),
+    ),
+    CryptoAsset(
+      symbol: 'USDC',
+      name: 'USD Coin',
+      amount: FixedDecimal(BigInt.from(5000000), 6),
+      logoUrl: null,
+      usdValue: FixedDecimal.parse('5.00'),
+    ),
+  ],
+);
+
+void main() {
+  late _FakeDevChain chain;
+  late JsonRpcClient client;
+  late StreamController<void> blocks;
+  late List<CryptoWallet> emitted;
+  late StreamSubscription<CryptoWallet> subscription;
+
+  // Announces a block and waits for the tracker's round trip for it; every
+  // tick's batch starts with eth_blockNumber.
+  Future<void> tick() async {
+    bool isTick(List<String> methods) => methods.first == 'eth_blockNumber';
+    final expected = chain.requests.where(isTick).length + 1;
+    blocks.add(null);
+    await until(
+      () => chain.requests.where(isTick).length >= expected,
+      what: 'the tracker',
+    );
+  }
+
+  // Scans trail the head by one tick: the first sees the new block, the
+  // second scans it.
+  Future<void> block() async {
+    await tick();
+    await tick();
+  }
+
+  Future<void> emissions(int count) =>
+      until(() => emitted.length >= count, what: 'the tracker');
+
+  setUp(() async {
+    chain = await _FakeDevChain.start();
+    client = JsonRpcClient(chain.uri);
+    blocks = StreamController<void>();
+    emitted = [];
+    subscription = BalanceTracker(
+      client: client,
+      tokenRegistry: _registry,
+      maxBlockRange: 5,
+      newBlocks: blocks.stream,
+    ).track(_wallet()).listen(emitted.add);
+    // The first tick only reads the head; blocks announced meanwhile are
+    // scanned once it ends.
+    await until(() => chain.requests.isNotEmpty, what: 'the tracker');
+  });
+
+  tearDown(() async {
+    await subscription.cancel();
+    client.dispose();
+    await chain.close();
+  });
+
+  test('idle blocks cost one batched call each and emit nothing', () async {
+    for (var i = 0; i < 3; i++) {
+      chain.mine();
+      await tick();
+    }
+    // Scans the last block, then finds nothing new and reads the head alone.
+    await tick();
+    await tick();
+
+    const scan = ['eth_blockNumber', 'eth_getBalance', 'eth_getLogs', 'eth_getLogs'];
+    expect(chain.requests, [
+      ['eth_blockNumber'],
+      for (var i = 0; i < 4; i++) scan,
+      ['eth_blockNumber'],
+    ]);
+    expect(emitted, isEmpty);
+  });
+
+  test('applies transfers as deltas and verifies only the touched token', () async {
+    chain.transfer(_usdc, from: _other, to: _owner, value: 2500000);
+    await block();
+    await emissions(1);
+    await until(() => chain.requests.last.first == 'eth_call');
+
+    expect(chain.requests.last, ['eth_call']);
+    final usdc = emitted.last.assets[1];
+    expect(usdc.amount, FixedDecimal.parse('7.5'));
+    expect(usdc.usdValue, FixedDecimal.parse('7.50'));
+
+    chain.transfer(_usdc, from: _owner, to: _other, value: 1000000);
+    await block();
+    await emissions(2);
+    expect(emitted.last.assets[1].amount, FixedDecimal.parse('6.5'));
+  });
+
+  test('rescans a range whose logs failed without losing transfers', () async {
+    chain.transfer(_usdc, from: _owner, to: _other, value: 1000000);
+    await tick();
+
+    // The outgoing filter succeeds, the incoming one is rejected.
+    chain.failIncomingLogs = true;
+    await tick();
+    expect(emitted, isEmpty);
+
+    chain.failIncomingLogs = false;
+    await tick();
+    await emissions(1);
+    expect(emitted.last.assets[1].amount, FixedDecimal.parse('4'));
+  });
+
+  test('appends registry tokens the owner receives and ignores unlisted ones', () async {
+    chain.transfer(_dai, from: _other, to: _owner, value: 3);
+    chain.transfer(_unlisted, from: _other, to: _owner, value: 9);
+    await block();
+    await emissions(1);
+
+    final symbols = emitted.last.assets.map((asset) => asset.symbol).toList();
+    expect(symbols, ['ETH', 'USDC', 'DAI']);
+    expect(emitted.last.assets.last.balance, BigInt.from(3));
+  });
+
+  test('updates the native balance and revalues it at the loaded price', () async {
+    chain.native = BigInt.parse('1500000000000000000');
+    chain.mine();
+    await block();
+    await emissions(1);
+
+    final eth = emitted.single.assets.first;
+    expect(eth.amount, FixedDecimal.parse('1.5'));
+    expect(eth.usdValue, FixedDecimal.parse('3000.00'));
+  });
+
+  test('re-reads held balances instead of scanning a long gap', () async {
+    chain.transfer(_usdc, from: _other, to: _owner, value: 2500000);
+    for (var i = 0; i < 5; i++) {
+      chain.mine();
+    }
+    await block();
+    await emissions(1);
+    await until(() => chain.requests.last.first == 'eth_call');
+
+    expect(chain.requests.skip(1), [
+      ['eth_blockNumber', 'eth_getBalance', 'eth_getLogs', 'eth_getLogs'],
+      ['eth_blockNumber', 'eth_getBalance'],
+      ['eth_call'],
+    ]);
+    expect(emitted.last.assets[1].amount, FixedDecimal.parse('7.5'));
+
+    // Scanning resumes after the head it re-read at.
+    chain.mine();
+    await block();
+    expect(chain.requests.last, [
+      'eth_blockNumber',
+      'eth_getBalance',
+      'eth_getLogs',
+      'eth_getLogs',
+    ]);
+  });
+}
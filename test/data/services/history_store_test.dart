@@ -0,0 +1,120 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/services/history_storage.dart';
+import 'package:crypto_treasury/data/services/history_store.dart';
+
+final _start = DateTime.utc(2026, 1, 1);
+
+CryptoWallet _wallet(int usd) => CryptoWallet(
+  address: '0x00000000000000000000000000000000000000aa',
+  chainId: 1,
+  assets: [
+    CryptoAsset(
+      symbol: 'ETH',
+      name: 'Ethereum Native',
+      amount: FixedDecimal.fromInt(2),
+      logoUrl: null,
+      usdValue: FixedDecimal.fromInt(usd),
+    ),
+  ],
+);
+
+// One snapshot every 30 seconds for three hours; the total is the index.
+Future<void> _recordThreeHours(HistoryStore store) async {
+  for (var i = 0; i < 360; i++) {
+    await store.record(_wallet(i), _start.add(Duration(seconds: 30 * i)));
+  }
+}
+
+void main() {
+  final end = _start.add(const Duration(hours: 3));
+
+  test('picks the finest level that fits the requested points', () async {
+    final store = await HistoryStore.open(MemoryHistoryStorage(), now: _start);
+    await _recordThreeHours(store);
+
+    final raw = store.query(HistoryStore.totalSeries, _start, end);
+    expect(raw.resolution, HistoryResolution.raw);
+    expect(raw.length, 360);
+
+    final minutes = store.query(
+      HistoryStore.totalSeries,
+      _start,
+      end,
+      maxPoints: 200,
+    );
+    expect(minutes.resolution, HistoryResolution.minute);
+    expect(minutes.length, 180);
+    expect(minutes.usdValues.first, 1);
+    expect(minutes.usdValues.last, 359);
+
+    final hours = store.query(
+      HistoryStore.totalSeries,
+      _start,
+      end,
+      maxPoints: 10,
+    );
+    expect(hours.resolution, HistoryResolution.hour);
+    expect(hours.usdValues, [119, 239, 359]);
+    expect(hours.times.first, _start.millisecondsSinceEpoch);
+
+    final days = store.query('1:ETH', _start, end, maxPoints: 1);
+    expect(days.resolution, HistoryResolution.day);
+    expect(days.balances, [2]);
+  });
+
+  test('reopens from storage and rebuilds the open buckets', () async {
+    final storage = MemoryHistoryStorage();
+    await _recordThreeHours(
+      await HistoryStore.open(storage, now: _start),
+    );
+
+    final reopened = await HistoryStore.open(storage, now: end);
+    expect(reopened.series, ['*', '1:ETH']);
+    expect(
+      reopened.query(HistoryStore.totalSeries, _start, end).length,
+      360,
+    );
+    final hours = reopened.query(
+      HistoryStore.totalSeries,
+      _start,
+      end,
+      maxPoints: 10,
+    );
+    expect(hours.usdValues, [119, 239, 359]);
+    final days = reopened.query(
+      HistoryStore.totalSeries,
+      _start,
+      end,
+      maxPoints: 1,
+    );
+    expect(days.usdValues, [359]);
+  });
+
+  test('drops rows past their level retention on open', () async {
+    final storage = MemoryHistoryStorage();
+    await _recordThreeHours(
+      await HistoryStore.open(storage, now: _start),
+    );
+
+    final later = _start.add(const Duration(days: 2));
+    final reopened = await HistoryStore.open(storage, now: later);
+    final range = reopened.query(HistoryStore.totalSeries, _start, later);
+    expect(range.resolution, HistoryResolution.minute);
+    // The minute still open at shutdown can no longer be rebuilt from raw.
+    expect(range.length, 179);
+    expect((await storage.readAll())['raw'], isEmpty);
+  });
+
+  test('ignores snapshots older than the latest', () async {
+    final store = await HistoryStore.open(MemoryHistoryStorage(), now: _start);
+    await store.record(_wallet(5), _start.add(const Duration(minutes: 1)));
+    await store.record(_wallet(9), _start);
+
+    final raw = store.query(HistoryStore.totalSeries, _start, end);
+    expect(raw.usdValues, [5]);
+  });
+}
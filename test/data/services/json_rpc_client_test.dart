@@ -0,0 +1,45 @@
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/services/json_rpc_client.dart';
+
+import '../../support/loopback_server.dart';
+
+void main() {
+  test('splits long batches and keeps results in request order', () async {
+    final sizes = <int>[];
+    final server = await LoopbackServer.start((HttpRequest request) async {
+      final calls = await readJsonRpcBatch(request);
+      sizes.add(calls.length);
+      await writeJsonRpcBatch(
+        request,
+        calls,
+        (call) => (call['params'] as List).first,
+        reversed: true,
+      );
+    });
+    addTearDown(server.close);
+    final client = JsonRpcClient(server.uri(), maxBatchSize: 100);
+    addTearDown(client.dispose);
+
+    final owners = [for (var i = 0; i < 250; i++) '0x${i.toRadixString(16)}'];
+    final results = await client.batch([
+      for (final owner in owners) JsonRpcRequest.getBalance(owner),
+    ]);
+
+    expect(sizes..sort(), [50, 100, 100]);
+    expect(results, owners);
+  });
+
+  test('rejects malformed quantities as RPC errors', () {
+    expect(JsonRpcClient.parseQuantity('0x'), BigInt.zero);
+    expect(JsonRpcClient.parseQuantity('0x1f'), BigInt.from(31));
+    for (final bad in ['0xzz', '0x-1', '12', null]) {
+      expect(
+        () => JsonRpcClient.parseQuantity(bad),
+        throwsA(isA<JsonRpcException>()),
+      );
+    }
+  });
+}
@@ -0,0 +1,225 @@
+import 'dart:async';
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/portfolio_service.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+import '../../support/loopback_server.dart';
+
+const _owner = '0x00000000000000000000000000000000000000aa';
+const _usdc = '0x00000000000000000000000000000000000000c1';
+const _dust = '0x00000000000000000000000000000000000000d1';
+const _polygonUsdc = '0x00000000000000000000000000000000000000c2';
+
+final _registry = TokenRegistry.fromTokens([
+  const TrackedToken(
+    chainId: 1,
+    address: _usdc,
+    symbol: 'USDC',
+    name: 'USD Coin',
+    decimals: 6,
+  ),
+  const TrackedToken(
+    chainId: 1,
+    address: _dust,
+    symbol: 'DUST',
+    name: 'Dust',
+    decimals: 18,
+  ),
+  const TrackedToken(
+    chainId: 137,
+    address: _polygonUsdc,
+    symbol: 'USDC',
+    name: 'USD Coin',
+    decimals: 6,
+  ),
+]);
+
+// Prices: ETH 2000, MATIC 0.5; tokens fall back to the stablecoin rule.
+final _prices = PriceService(
+  httpClient: MockClient((request) async {
+    final ids = request.url.queryParameters['ids'];
+    if (ids == 'ethereum') {
+      return http.Response('{"ethereum":{"usd":2000}}', 200);
+    }
+    if (ids == 'matic-network') {
+      return http.Response('{"matic-network":{"usd":0.5}}', 200);
+    }
+    return http.Response('{}', 200);
+  }),
+);
+
+/// Answers batched eth_getBalance / balanceOf calls like a JSON-RPC node.
+class _FakeRpcServer {
+  _FakeRpcServer(this.native, this.tokens, this.delay, this.status);
+
+  static Future<_FakeRpcServer> start({
+    required BigInt native,
+    Map<String, BigInt> tokens = const {},
+    Duration delay = Duration.zero,
+    int status = 200,
+  }) async {
+    final fake = _FakeRpcServer(native, tokens, delay, status);
+    fake._server = await LoopbackServer.start(fake._handle);
+    return fake;
+  }
+
+  late final LoopbackServer _server;
+  final BigInt native;
+  final Map<String, BigInt> tokens;
+  final Duration delay;
+  final int status;
+  int requests = 0;
+
+  Uri get uri => _server.uri();
+
+  Future<void> close() => _server.close();
+
+  Future<void> _handle(HttpRequest request) async {
+    requests++;
+    final calls = await readJsonRpcBatch(request);
+    await Future<void>.delayed(delay);
+    if (status != 200) {
+      request.response.statusCode = status;
+      await request.response.close();
+      return;
+    }
+    await writeJsonRpcBatch(request, calls, _answer, reversed: true);
+  }
+
+  String _answer(Map<String, dynamic> call) {
+    final params = call['params'] as List;
+    final value = call['method'] == 'eth_getBalance'
+        ? native
+        : tokens[(params.first as Map)['to']] ?? BigInt.zero;
+    return '0x${value.toRadixString(16)}';
+  }
+}
+
+void main() {
+  final servers = <_FakeRpcServer>[];
+
+  Future<_FakeRpcServer> server({
+    required BigInt native,
+    Map<String, BigInt> tokens = const {},
+    Duration delay = Duration.zero,
+    int status = 200,
+  }) async {
+    final started = await _FakeRpcServer.start(
+      native: native,
+      tokens: tokens,
+      delay: delay,
+      status: status,
+    );
+    servers.add(started);
+    return started;
+  }
+
+  tearDown(() async {
+    for (final server in servers) {
+      await server.close();
+    }
+    servers.clear();
+  });
+
+  test('reads chains in parallel and merges them in answer order', () async {
+    final ethereum = await server(
+      native: BigInt.parse('1500000000000000000'),
+      tokens: {_usdc: BigInt.from(250000000)},
+    );
+    final polygon = await server(
+      native: BigInt.parse('4000000000000000000'),
+      tokens: {_polygonUsdc: BigInt.from(1000000)},
+      delay: const Duration(milliseconds: 200),
+    );
+    final service = PortfolioService(
+      endpoints: {137: polygon.uri, 1: ethereum.uri},
+      httpClient: http.Client(),
+      priceService: _prices,
+    );
+    addTearDown(service.dispose);
+
+    final clock = Stopwatch()..start();
+    final wallets = await service
+        .watchPortfolio(address: _owner, tokenRegistry: _registry)
+        .toList();
+    clock.stop();
+
+    final wallet = wallets.last;
+    expect(wallet.chainId, CryptoWallet.allChains);
+    expect(
+      wallet.assets.map((asset) => '${asset.chainId}:${asset.symbol}'),
+      ['1:ETH', '1:USDC', '137:MATIC', '137:USDC'],
+    );
+    expect(
+      wallet.assets.map((asset) => asset.usdValue.toString()),
+      ['3000.00', '250.00', '2.00', '1.00'],
+    );
+    expect(wallet.totalUsdValue.toString(), '3253.00');
+
+    expect(wallet.chains.map((chain) => chain.chainId), [1, 137]);
+    expect(wallet.chains.first.usdValue.toString(), '3250.00');
+    expect(wallet.chains.last.assetCount, 2);
+    expect(
+      wallet.chains.last.rpcLatency,
+      greaterThanOrEqualTo(const Duration(milliseconds: 200)),
+    );
+    expect(wallet.chains.first.rpcLatency, lessThan(wallet.chains.last.rpcLatency));
+    expect(clock.elapsed, lessThan(const Duration(milliseconds: 400)));
+
+    // One batched round trip per chain.
+    expect(ethereum.requests, 1);
+    expect(polygon.requests, 1);
+
+    // Earlier emissions are prefixes of later ones.
+    for (var i = 1; i < wallets.length; i++) {
+      final previous = wallets[i - 1].assets;
+      expect(wallets[i].assets.length, greaterThanOrEqualTo(previous.length));
+      for (var j = 0; j < previous.length; j++) {
+        expect(wallets[i].assets[j].symbol, previous[j].symbol);
+      }
+    }
+  });
+
+  test('reports a failing chain and keeps the others', () async {
+    final ethereum = await server(native: BigInt.zero);
+    final polygon = await server(native: BigInt.zero, status: 503);
+    final service = PortfolioService(
+      endpoints: {1: ethereum.uri, 137: polygon.uri},
+      httpClient: http.Client(),
+      priceService: _prices,
+    );
+    addTearDown(service.dispose);
+
+    final wallet = await service
+        .watchPortfolio(address: _owner, tokenRegistry: _registry)
+        .last;
+
+    expect(wallet.assets.map((asset) => asset.symbol), ['ETH']);
+    final failed = wallet.chains.singleWhere((chain) => chain.chainId == 137);
+    expect(failed.error, contains('503'));
+    expect(failed.assetCount, 0);
+  });
+
+  test('fails only when every chain fails', () async {
+    final polygon = await server(native: BigInt.zero, status: 500);
+    final service = PortfolioService(
+      endpoints: {137: polygon.uri},
+      httpClient: http.Client(),
+      priceService: _prices,
+    );
+    addTearDown(service.dispose);
+
+    expect(
+      service.watchPortfolio(address: _owner, tokenRegistry: _registry).toList(),
+      throwsStateError,
+    );
+  });
+}
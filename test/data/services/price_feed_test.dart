@@ -0,0 +1,127 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+
+import 'package:crypto_treasury/data/services/price_feed.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+
+import '../../support/loopback_server.dart';
+
+/// A price source stand-in: accepts WebSocket subscribers and pushes
+/// whatever the test sends.
+class _StubPriceServer {
+  static Future<_StubPriceServer> start() async {
+    final stub = _StubPriceServer();
+    stub._server = await LoopbackServer.start(stub._accept);
+    return stub;
+  }
+
+  late final LoopbackServer _server;
+  final List<WebSocket> _sockets = [];
+  final List<Object?> subscriptions = [];
+
+  Uri get uri => _server.uri(scheme: 'ws', path: '/prices');
+
+  Future<void> _accept(HttpRequest request) async {
+    final socket = await WebSocketTransformer.upgrade(request);
+    _sockets.add(socket);
+    socket.listen(
+      (message) => subscriptions.add(jsonDecode(message as String)),
+    );
+  }
+
+  void push(Map<String, Object?> message) =>
+      _sockets.last.add(jsonEncode(message));
+
+  Future<void> dropAll() async {
+    for (final socket in _sockets) {
+      await socket.close();
+    }
+  }
+
+  Future<void> close() async {
+    await dropAll();
+    await _server.close();
+  }
+}
+
+void main() {
+  late _StubPriceServer server;
+  late int polls;
+  late PriceFeed feed;
+
+  setUp(() async {
+    server = await _StubPriceServer.start();
+    polls = 0;
+    feed = PriceFeed(
+      streamUri: server.uri,
+      pollInterval: const Duration(milliseconds: 50),
+      reconnectDelay: const Duration(milliseconds: 200),
+      priceService: PriceService(
+        httpClient: MockClient((request) async {
+          polls++;
+          return http.Response('{"ethereum":{"usd":1900}}', 200);
+        }),
+      ),
+    );
+  });
+
+  tearDown(() async {
+    feed.dispose();
+    await server.close();
+  });
+
+  test('subscribes and forwards only changed prices of held symbols', () async {
+    final updates = <Map<String, double>>[];
+    final subscription = feed
+        .watch({'ETH': 'ethereum', 'USDC': 'usd-coin'})
+        .listen(updates.add);
+    await until(() => server.subscriptions.isNotEmpty);
+
+    expect(server.subscriptions.single, {
+      'type': 'subscribe',
+      'symbols': ['ETH', 'USDC'],
+    });
+
+    server.push({
+      'prices': {'ETH': 2000.5, 'USDC': 1.0, 'BTC': 60000},
+    });
+    await until(() => updates.isNotEmpty);
+    expect(updates.single, {'ETH': 2000.5, 'USDC': 1.0});
+
+    server.push({'symbol': 'USDC', 'usd': 1.0});
+    server.push({'symbol': 'ETH', 'usd': 2001});
+    await until(() => updates.length == 2);
+    expect(updates.last, {'ETH': 2001.0});
+    expect(polls, 0);
+
+    await subscription.cancel();
+  });
+
+  test('polls while the stream is down and stops once it reconnects', () async {
+    final updates = <Map<String, double>>[];
+    final subscription = feed.watch({'ETH': 'ethereum'}).listen(updates.add);
+    await until(() => server.subscriptions.isNotEmpty);
+
+    await server.dropAll();
+    await until(() => updates.isNotEmpty);
+    expect(updates.single, {'ETH': 1900.0});
+    expect(polls, greaterThan(0));
+
+    await until(() => server.subscriptions.length == 2);
+    await Future<void>.delayed(const Duration(milliseconds: 100));
+    final pollsAfterReconnect = polls;
+    await Future<void>.delayed(const Duration(milliseconds: 200));
+    expect(polls, pollsAfterReconnect);
+
+    server.push({'symbol': 'ETH', 'usd': 2100});
+    await until(() => updates.length == 2);
+    expect(updates.last, {'ETH': 2100.0});
+
+    await subscription.cancel();
+  });
+}
@@ -0,0 +1,41 @@
+import 'package:flutter_test/flutter_test.dart';
+import 'package:http/http.dart' as http;
+import 'package:http/testing.dart';
+
+import 'package:crypto_treasury/data/models/tracked_token.dart';
+import 'package:crypto_treasury/data/services/price_service.dart';
+
+void main() {
+  test('splits long contract lists across requests and merges the prices', () async {
+    final queried = <int>[];
+    final prices = PriceService(
+      httpClient: MockClient((request) async {
+        final addresses =
+            request.url.queryParameters['contract_addresses']!.split(',');
+        queried.add(addresses.length);
+        return http.Response(
+          '{${addresses.map((address) => '"$address":{"usd":2}').join(',')}}',
+          200,
+        );
+      }),
+    );
+    addTearDown(prices.dispose);
+
+    final tokens = [
+      for (var i = 0; i < 230; i++)
+        TrackedToken(
+          chainId: 1,
+          address: '0x${i.toRadixString(16).padLeft(40, '0')}',
+          symbol: 'T$i',
+          name: 'Token $i',
+          decimals: 18,
+          coingeckoId: 't$i',
+        ),
+    ];
+    final usd = await prices.fetchTokenUsdPrices(1, tokens);
+
+    expect(queried..sort(), [30, 100, 100]);
+    expect(usd.length, 230);
+    expect(usd[tokens.last.address], 2);
+  });
+}
@@ -0,0 +1,84 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/services/token_registry.dart';
+
+const _usdcMainnet = '0xA0b86991c6218b36c1d19d4a2e9eB0cE3606eB48';
+const _usdcPolygon = '0x3c499c542cEF5E3811e1192ce70d8cC03d5c3359';
+
+final _tokenList = jsonEncode({
+  'name': 'Test list',
+  'tokens': [
+    {
+      'chainId': 1,
+      'address': _usdcMainnet,
+      'symbol': 'USDC',
+      'name': 'USD Coin',
+      'decimals': 6,
+      'logoURI': 'https://example.com/usdc.png',
+      'extensions': {'coingeckoId': 'usd-coin'},
+    },
+    {
+      'chainId': 137,
+      'address': _usdcPolygon,
+      'symbol': 'USDC',
+      'name': 'USD Coin',
+      'decimals': 6,
+      'logoURI': 'https://example.com/usdc.png',
+    },
+    {
+      'chainId': 1,
+      'address': _usdcMainnet.toLowerCase(),
+      'symbol': 'DUPE',
+      'name': 'Duplicate',
+      'decimals': 6,
+    },
+    {'chainId': 1, 'symbol': 'BROKEN'},
+  ],
+});
+
+void main() {
+  test('indexes tokens by chain and case-insensitive address', () {
+    final registry = TokenRegistry.parseTokenList(_tokenList);
+
+    expect(registry.length, 2);
+    expect(registry.tokensOn(1).map((token) => token.symbol), ['USDC']);
+    expect(registry.tokensOn(56), isEmpty);
+
+    final usdc = registry.lookup(1, _usdcMainnet.toUpperCase())!;
+    expect(usdc.address, _usdcMainnet.toLowerCase());
+    expect(usdc.coingeckoId, 'usd-coin');
+    expect(registry.lookup(137, _usdcMainnet), isNull);
+  });
+
+  test('shares one String per distinct value', () {
+    final registry = TokenRegistry.parseTokenList(_tokenList);
+    final mainnet = registry.tokensOn(1).single;
+    final polygon = registry.tokensOn(137).single;
+
+    expect(identical(mainnet.name, polygon.name), isTrue);
+    expect(identical(mainnet.symbol, polygon.symbol), isTrue);
+    expect(identical(mainnet.logoUrl, polygon.logoUrl), isTrue);
+  });
+
+  test('round-trips through the compact form', () {
+    final registry = TokenRegistry.parseTokenList(_tokenList);
+    final bytes = registry.encodeCompact();
+    expect(TokenRegistry.isCompact(bytes), isTrue);
+    expect(TokenRegistry.isCompact(Uint8List.fromList(utf8.encode(_tokenList))), isFalse);
+
+    final decoded = TokenRegistry.decodeCompact(bytes);
+    expect(decoded.length, registry.length);
+    final polygon = decoded.lookup(137, _usdcPolygon)!;
+    expect(polygon.address, _usdcPolygon.toLowerCase());
+    expect(polygon.decimals, 6);
+    expect(polygon.coingeckoId, isNull);
+    expect(polygon.logoUrl, 'https://example.com/usdc.png');
+    expect(
+      identical(decoded.tokensOn(1).single.name, polygon.name),
+      isTrue,
+    );
+  });
+}
@@ -0,0 +1,77 @@
+import 'dart:async';
+import 'dart:convert';
+import 'dart:io';
+
+import 'package:flutter_test/flutter_test.dart';
+
+/// An HTTP server on a free loopback port, standing in for a remote service
+/// in tests. Every request goes to the handler it was started with.
+class LoopbackServer {
+  LoopbackServer._(this._server, Future<void> Function(HttpRequest) handle) {
+    _server.listen(handle);
+  }
+
+  static Future<LoopbackServer> start(
+    Future<void> Function(HttpRequest request) handle,
+  ) async => LoopbackServer._(
+    await HttpServer.bind(InternetAddress.loopbackIPv4, 0),
+    handle,
+  );
+
+  final HttpServer _server;
+
+  Uri uri({String scheme = 'http', String path = '/'}) =>
+      Uri.parse('$scheme://127.0.0.1:${_server.port}$path');
+
+  Future<void> close() => _server.close(force: true);
+}
+
+/// The calls of a batched JSON-RPC [request].
+Future<List<Map<String, dynamic>>> readJsonRpcBatch(HttpRequest request) async =>
+    (jsonDecode(await utf8.decodeStream(request)) as List)
+        .cast<Map<String, dynamic>>();
+
+/// A per-call error for [writeJsonRpcBatch] to send instead of a result.
+class JsonRpcErrorAnswer {
+  const JsonRpcErrorAnswer(this.code, this.message);
+
+  final int code;
+  final String message;
+}
+
+/// Answers each of [calls] with the result [answer] gives for it, in reverse
+/// order when [reversed] (nodes may answer a batch in any order).
+Future<void> writeJsonRpcBatch(
+  HttpRequest request,
+  List<Map<String, dynamic>> calls,
+  Object? Function(Map<String, dynamic> call) answer, {
+  bool reversed = false,
+}) async {
+  final answers = [
+    for (final call in calls)
+      switch (answer(call)) {
+        JsonRpcErrorAnswer(:final code, :final message) => {
+          'jsonrpc': '2.0',
+          'id': call['id'],
+          'error': {'code': code, 'message': message},
+        },
+        final result => {'jsonrpc': '2.0', 'id': call['id'], 'result': result},
+      },
+  ];
+  request.response.headers.contentType = ContentType.json;
+  request.response.write(
+    jsonEncode(reversed ? answers.reversed.toList() : answers),
+  );
+  await request.response.close();
+}
+
+/// Waits until [condition] holds, failing the test after five seconds.
+Future<void> until(bool Function() condition, {String what = 'the server'}) async {
+  final deadline = DateTime.now().add(const Duration(seconds: 5));
+  while (!condition()) {
+    if (DateTime.now().isAfter(deadline)) {
+      fail('Timed out waiting for $what');
+    }
+    await Future<void>.delayed(const Duration(milliseconds: 5));
+  }
+}
@@ -0,0 +1,83 @@
+import 'dart:async';
+
+import 'package:crypto_treasury/data/models/crypto_asset.dart';
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/models/fixed_decimal.dart';
+import 'package:crypto_treasury/data/repositories/wallet_repository.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/wallet_view_model.dart';
+
+/// A native asset holding [amount] of [symbol], valued at [price] USD each.
+CryptoAsset testAsset(
+  String symbol, {
+  String amount = '1',
+  double price = 1,
+  String? name,
+}) {
+  final fixed = FixedDecimal.parse(amount);
+  return CryptoAsset(
+    symbol: symbol,
+    name: name ?? symbol,
+    amount: fixed,
+    logoUrl: null,
+    usdValue: CryptoAsset.valueAt(fixed, price),
+  );
+}
+
+/// A mainnet wallet holding [assets].
+CryptoWallet testWallet(List<CryptoAsset> assets) => CryptoWallet(
+  address: '0xabc',
+  chainId: 1,
+  assets: List.unmodifiable(assets),
+);
+
+/// A supported MetaMask that never connects or changes account or chain.
+class IdleRepository implements WalletRepository {
+  @override
+  bool get isSupported => true;
+
+  @override
+  bool get isConnected => false;
+
+  @override
+  Stream<List<String>> get accountStream => const Stream.empty();
+
+  @override
+  Stream<int> get chainStream => const Stream.empty();
+
+  @override
+  void dispose() {}
+
+  @override
+  dynamic noSuchMethod(Invocation invocation) => super.noSuchMethod(invocation);
+}
+
+/// A repository whose wallet loads the test feeds by hand: every refresh
+/// adds a stream to [loads], and tracker updates come from [tracked].
+class ScriptedRepository extends IdleRepository {
+  final List<StreamController<CryptoWallet>> loads = [];
+  final StreamController<CryptoWallet> tracked =
+      StreamController<CryptoWallet>.broadcast();
+
+  @override
+  Stream<CryptoWallet> refreshWallet() {
+    final load = StreamController<CryptoWallet>();
+    loads.add(load);
+    return load.stream;
+  }
+
+  @override
+  Stream<CryptoWallet> trackWallet(CryptoWallet wallet) => tracked.stream;
+
+  @override
+  Stream<Map<String, double>> watchPrices(CryptoWallet wallet) =>
+      const Stream.empty();
+}
+
+/// A view model whose state the test sets directly.
+class ScriptedViewModel extends WalletViewModel {
+  ScriptedViewModel() : super(IdleRepository());
+
+  WalletUiState get current => state;
+
+  set current(WalletUiState next) => state = next;
+}
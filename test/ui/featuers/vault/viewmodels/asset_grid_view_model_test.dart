@@ -0,0 +1,42 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/asset_grid_view_model.dart';
+
+const List<AssetOrderRow> _rows = [
+  (key: '1|USDC|USD Coin', symbol: 'USDC', name: 'USD Coin', usd: 100.0),
+  (key: '1|ETH|Ethereum Native', symbol: 'ETH', name: 'Ethereum Native', usd: 4000.0),
+  (key: '137|USDC|USD Coin', symbol: 'USDC', name: 'USD Coin', usd: 100.0),
+  (key: '1|DAI|Dai Stablecoin', symbol: 'DAI', name: 'Dai Stablecoin', usd: 50.0),
+];
+
+List<String> _order(AssetSort sort, [String filter = '']) =>
+    orderAssetRows((_rows, AssetGridQuery(sort: sort, filter: filter)));
+
+void main() {
+  test('keeps wallet order unless asked to sort', () {
+    expect(_order(AssetSort.wallet), [for (final row in _rows) row.key]);
+  });
+
+  test('sorts by value and symbol, keeping wallet order on ties', () {
+    expect(_order(AssetSort.value), [
+      '1|ETH|Ethereum Native',
+      '1|USDC|USD Coin',
+      '137|USDC|USD Coin',
+      '1|DAI|Dai Stablecoin',
+    ]);
+    expect(_order(AssetSort.symbol), [
+      '1|DAI|Dai Stablecoin',
+      '1|ETH|Ethereum Native',
+      '1|USDC|USD Coin',
+      '137|USDC|USD Coin',
+    ]);
+  });
+
+  test('filters on symbol or name, ignoring case', () {
+    expect(_order(AssetSort.wallet, 'stable'), ['1|DAI|Dai Stablecoin']);
+    expect(_order(AssetSort.symbol, 'usd'), [
+      '1|USDC|USD Coin',
+      '137|USDC|USD Coin',
+    ]);
+  });
+}
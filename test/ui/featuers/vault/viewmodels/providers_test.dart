@@ -0,0 +1,165 @@
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/data/repositories/history_repository.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
+
+import '../../../../support/wallet_doubles.dart';
+
+/// Keeps recorded wallets in memory instead of storage.
+class _RecordingHistory implements HistoryRepository {
+  final List<CryptoWallet> recorded = [];
+
+  @override
+  Future<void> record(CryptoWallet wallet) async => recorded.add(wallet);
+
+  @override
+  dynamic noSuchMethod(Invocation invocation) => super.noSuchMethod(invocation);
+}
+
+List<String> _symbols(CryptoWallet wallet) => [
+  for (final asset in wallet.assets) asset.symbol,
+];
+
+void main() {
+  group('wallet slices', () {
+    late ProviderContainer container;
+    late ScriptedViewModel viewModel;
+    late Map<String, int> notifications;
+
+    void count<T>(String name, ProviderListenable<T> provider) {
+      notifications[name] = 0;
+      container.listen<T>(
+        provider,
+        (_, __) => notifications[name] = notifications[name]! + 1,
+      );
+    }
+
+    setUp(() {
+      viewModel = ScriptedViewModel();
+      container = ProviderContainer(
+        overrides: [walletViewModelProvider.overrideWith((ref) => viewModel)],
+      );
+      viewModel.current = viewModel.current.copyWith(
+        wallet: testWallet([
+          testAsset('ETH', amount: '2', price: 2000),
+          testAsset('USDC', amount: '100'),
+          testAsset('DAI', amount: '50'),
+        ]),
+      );
+
+      notifications = {};
+      count('status', walletStatusProvider);
+      count('unity', walletUnityProvider);
+      count('keys', walletAssetKeysProvider);
+      count('total', walletProvider.select((wallet) => wallet?.totalUsdValue));
+      for (final key in container.read(walletAssetKeysProvider)) {
+        count(key, walletAssetProvider(key));
+      }
+    });
+
+    tearDown(() => container.dispose());
+
+    test('a price stream notifies only the repriced asset and the total', () {
+      final eth = container.read(walletAssetKeysProvider).first;
+      for (var tick = 1; tick <= 20; tick++) {
+        final wallet = viewModel.current.wallet!;
+        viewModel.current = viewModel.current.copyWith(
+          wallet: wallet.repriced({'ETH': 2000.0 + tick}),
+        );
+      }
+
+      expect(notifications, {
+        'status': 0,
+        'unity': 0,
+        'keys': 0,
+        'total': 20,
+        eth: 20,
+        'null|USDC|USDC': 0,
+        'null|DAI|DAI': 0,
+      });
+    });
+
+    test('the refresh spinner notifies only the status', () {
+      viewModel.current = viewModel.current.copyWith(isRefreshing: true);
+      viewModel.current = viewModel.current.copyWith(isRefreshing: false);
+
+      expect(notifications.values.where((count) => count > 0).toList(), [2]);
+      expect(notifications['status'], 2);
+    });
+
+    test('a balance change re-projects Unity but keeps the grid keys', () {
+      final wallet = viewModel.current.wallet!;
+      final assets = List.of(wallet.assets);
+      assets[2] = testAsset('DAI', amount: '75');
+      viewModel.current = viewModel.current.copyWith(
+        wallet: wallet.copyWith(assets: List.unmodifiable(assets)),
+      );
+
+      expect(notifications['unity'], 1);
+      expect(notifications['keys'], 0);
+      expect(notifications['null|DAI|DAI'], 1);
+      expect(notifications['null|USDC|USDC'], 0);
+    });
+  });
+
+  group('history', () {
+    late ScriptedRepository repository;
+    late _RecordingHistory history;
+    late ProviderContainer container;
+
+    setUp(() {
+      repository = ScriptedRepository();
+      history = _RecordingHistory();
+      container = ProviderContainer(
+        overrides: [
+          walletRepositoryProvider.overrideWithValue(repository),
+          historyRepositoryProvider.overrideWithValue(history),
+        ],
+      );
+    });
+
+    tearDown(() => container.dispose());
+
+    test('records finished loads and later updates, not partial wallets', () async {
+      final load = container.read(walletViewModelProvider.notifier).refreshWallet();
+      repository.loads.single
+        ..add(testWallet([testAsset('ETH', amount: '2', price: 2000)]))
+        ..add(
+          testWallet([
+            testAsset('ETH', amount: '2', price: 2000),
+            testAsset('USDC', amount: '100'),
+          ]),
+        );
+      await Future<void>.delayed(Duration.zero);
+      expect(history.recorded, isEmpty);
+
+      await repository.loads.single.close();
+      await load;
+      expect(history.recorded.map(_symbols), [
+        ['ETH', 'USDC'],
+      ]);
+
+      repository.tracked.add(
+        testWallet([
+          testAsset('ETH', amount: '1', price: 2000),
+          testAsset('USDC', amount: '100'),
+        ]),
+      );
+      await Future<void>.delayed(Duration.zero);
+      expect(history.recorded, hasLength(2));
+      expect(history.recorded.last.assets.first.amount, FixedDecimal.parse('1'));
+    });
+
+    test('does not record a load that failed part way', () async {
+      final load = container.read(walletViewModelProvider.notifier).refreshWallet();
+      repository.loads.single
+        ..add(testWallet([testAsset('ETH', amount: '2', price: 2000)]))
+        ..addError(StateError('rpc down'));
+      await load;
+
+      expect(history.recorded, isEmpty);
+    });
+  });
+}
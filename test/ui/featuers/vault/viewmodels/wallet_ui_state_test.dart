@@ -0,0 +1,44 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/data/models/crypto_wallet.dart';
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/wallet_view_model.dart';
+
+import '../../../../support/wallet_doubles.dart';
+
+CryptoWallet _usdc(String amount) =>
+    testWallet([testAsset('usdc', amount: amount, name: 'USD Coin')]);
+
+void main() {
+  test('unrelated changes keep the Unity projection', () {
+    final state = WalletUiState.initial(
+      isSupported: true,
+    ).copyWith(wallet: _usdc('12.5'));
+    final payload = state.unity.payload;
+
+    final toggled = state
+        .copyWith(isRefreshing: true)
+        .copyWith(errorMessage: 'offline')
+        .copyWith(clearError: true);
+
+    expect(identical(toggled.unity, state.unity), isTrue);
+    expect(identical(toggled.unity.payload, payload), isTrue);
+  });
+
+  test('wallet changes bump the version and re-project', () {
+    final first = WalletUiState.initial(
+      isSupported: true,
+    ).copyWith(wallet: _usdc('1'));
+    final second = first.copyWith(wallet: _usdc('2'));
+    final cleared = second.copyWith(clearWallet: true);
+
+    expect(second.walletVersion, first.walletVersion + 1);
+    expect(cleared.walletVersion, second.walletVersion + 1);
+    expect(second.unity.balances.single['symbol'], 'USDC');
+    expect(second.unity.balances.single['amount'], 2.0);
+    expect(cleared.unity.balances, isEmpty);
+    expect(
+      () => second.unity.balances.single['amount'] = 3,
+      throwsUnsupportedError,
+    );
+  });
+}
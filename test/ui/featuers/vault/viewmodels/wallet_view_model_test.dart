@@ -0,0 +1,107 @@
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/wallet_view_model.dart';
+
+import '../../../../support/wallet_doubles.dart';
+
+// Lets the view model handle everything added to the load streams so far.
+Future<void> _delivered() => Future<void>.delayed(Duration.zero);
+
+void main() {
+  late ScriptedRepository repository;
+  late WalletViewModel viewModel;
+
+  List<String> shown() => [
+    for (final asset in viewModel.state.wallet!.assets)
+      '${asset.symbol} ${asset.amount}',
+  ];
+
+  setUp(() async {
+    repository = ScriptedRepository();
+    viewModel = WalletViewModel(repository);
+
+    final load = viewModel.refreshWallet();
+    repository.loads.single
+      ..add(
+        testWallet([
+          testAsset('ETH'),
+          testAsset('USDC', amount: '10'),
+          testAsset('DAI', amount: '5'),
+        ]),
+      )
+      ..close();
+    await load;
+  });
+
+  tearDown(() => viewModel.dispose());
+
+  test('a reload keeps the previous order while assets stream in', () async {
+    final reload = viewModel.refreshWallet();
+    final load = repository.loads.last;
+
+    load.add(
+      testWallet([
+        testAsset('DAI', amount: '6'),
+        testAsset('WETH', amount: '2'),
+      ]),
+    );
+    await _delivered();
+    expect(shown(), ['ETH 1', 'USDC 10', 'DAI 6', 'WETH 2']);
+    expect(viewModel.state.isPartial, isTrue);
+
+    load.add(
+      testWallet([
+        testAsset('USDC', amount: '11'),
+        testAsset('DAI', amount: '6'),
+        testAsset('WETH', amount: '2'),
+      ]),
+    );
+    await _delivered();
+    expect(shown(), ['ETH 1', 'USDC 11', 'DAI 6', 'WETH 2']);
+
+    await load.close();
+    await reload;
+    expect(shown(), ['USDC 11', 'DAI 6', 'WETH 2']);
+    expect(viewModel.state.isRefreshing, isFalse);
+    expect(viewModel.state.isPartial, isFalse);
+  });
+
+  test('a reload that fails keeps the assets it has not reached', () async {
+    final reload = viewModel.refreshWallet();
+    final load = repository.loads.last;
+
+    load.add(testWallet([testAsset('USDC', amount: '12')]));
+    load.addError(StateError('rpc down'));
+    await reload;
+
+    expect(shown(), ['ETH 1', 'USDC 12', 'DAI 5']);
+    expect(viewModel.state.errorMessage, contains('rpc down'));
+    expect(viewModel.state.isPartial, isTrue);
+  });
+
+  test('a newer load cancels the one in progress', () async {
+    final older = viewModel.refreshWallet();
+    final olderLoad = repository.loads.last;
+    olderLoad.add(testWallet([testAsset('ETH', amount: '2')]));
+    await _delivered();
+
+    final newer = viewModel.refreshWallet();
+    final newerLoad = repository.loads.last;
+    await older;
+    expect(olderLoad.hasListener, isFalse);
+
+    olderLoad.add(testWallet([testAsset('ETH', amount: '3')]));
+    newerLoad
+      ..add(
+        testWallet([
+          testAsset('ETH', amount: '4'),
+          testAsset('USDC', amount: '10'),
+          testAsset('DAI', amount: '5'),
+        ]),
+      )
+      ..close();
+    await newer;
+
+    expect(shown(), ['ETH 4', 'USDC 10', 'DAI 5']);
+  });
+}
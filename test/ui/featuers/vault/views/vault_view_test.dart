@@ -0,0 +1,68 @@
+import 'package:flutter/material.dart';
+import 'package:flutter_riverpod/flutter_riverpod.dart';
+import 'package:flutter_test/flutter_test.dart';
+
+import 'package:crypto_treasury/ui/featuers/vault/viewmodels/providers.dart';
+import 'package:crypto_treasury/ui/featuers/vault/views/vault_view.dart';
+import 'package:crypto_treasury/ui/featuers/vault/widgets/vault_asset_card.dart';
+
+import '../../../../support/wallet_doubles.dart';
+
+void main() {
+  testWidgets('a price tick rebuilds only the repriced cell', (tester) async {
+    // Tall enough that every cell is laid out below the header.
+    tester.view.physicalSize = const Size(1280, 3000);
+    tester.view.devicePixelRatio = 1;
+    addTearDown(tester.view.reset);
+
+    final viewModel = ScriptedViewModel();
+    viewModel.current = viewModel.current.copyWith(
+      wallet: testWallet([
+        testAsset('ETH', amount: '10', price: 2000),
+        testAsset('USDC', amount: '10'),
+        testAsset('DAI', amount: '10'),
+        testAsset('WBTC', amount: '10', price: 60000),
+      ]),
+    );
+    await tester.pumpWidget(
+      ProviderScope(
+        overrides: [walletViewModelProvider.overrideWith((ref) => viewModel)],
+        child: const MaterialApp(home: VaultView()),
+      ),
+    );
+    await tester.pumpAndSettle();
+    expect(find.byType(VaultAssetCard), findsNWidgets(4));
+
+    // Cells are counted by asset key, every other widget by type.
+    final builds = <String, int>{};
+    debugOnRebuildDirtyWidget = (element, _) {
+      final widget = element.widget;
+      final key = widget.key;
+      final name = widget.runtimeType.toString() == '_AssetCell' &&
+              key is ValueKey<String>
+          ? key.value
+          : widget.runtimeType.toString();
+      builds[name] = (builds[name] ?? 0) + 1;
+    };
+    try {
+      for (var tick = 1; tick <= 10; tick++) {
+        final wallet = viewModel.current.wallet!;
+        viewModel.current = viewModel.current.copyWith(
+          wallet: wallet.repriced({'ETH': 2000.0 + tick}),
+        );
+        await tester.pump();
+      }
+    } finally {
+      debugOnRebuildDirtyWidget = null;
+    }
+
+    expect(builds['null|ETH|ETH'], 10);
+    expect(builds['VaultAssetCard'], 10);
+    expect(builds['null|USDC|USDC'], isNull);
+    expect(builds['null|DAI|DAI'], isNull);
+    expect(builds['null|WBTC|WBTC'], isNull);
+    expect(builds['VaultView'], isNull);
+    expect(builds['_VaultContent'], isNull);
+    expect(builds['_AssetGrid'], isNull);
+  });
+}
@@ -0,0 +1,85 @@
+// Writes web/3d/build-manifest.json for the Unity WebGL build in web/3d/Build.
+//
+// The vault service worker (web/3d/vault_sw.js) keys its cache on the content
+// hashes recorded here and drops entries that no longer appear in the manifest,
+// so re-run this after copying a new Unity build into web/3d/Build:
+//
+//   node tool/unity_build_manifest.mjs [buildDir] [manifestPath]
+//
+// The manifest is a deploy artifact and is not committed. The tool refuses to
+// write one unless every artifact web/3d/index.html loads is present, since
+// an artifact missing from the manifest always goes to the network.
+import { createHash } from 'node:crypto';
+import { existsSync, readdirSync, readFileSync, writeFileSync } from 'node:fs';
+import { basename, join, resolve } from 'node:path';
+import { brotliDecompressSync, gunzipSync } from 'node:zlib';
+
+const buildDir = resolve(process.argv[2] ?? 'web/3d/Build');
+const manifestPath = resolve(process.argv[3] ?? join(buildDir, '..', 'build-manifest.json'));
+
+// The loader config in web/3d/index.html (buildUrl 'Build/Build').
+const requiredArtifacts = [
+  'Build.loader.js',
+  'Build.framework.js.unityweb',
+  'Build.data.unityweb',
+  'Build.wasm.unityweb',
+];
+
+const missing = requiredArtifacts.filter((name) => !existsSync(join(buildDir, name)));
+if (missing.length > 0) {
+  console.error(`[unity_build_manifest] incomplete build in ${buildDir}; missing ${missing.join(', ')}`);
+  process.exit(1);
+}
+
+const contentTypeFor = (name) => {
+  const stripped = name.replace(/\.(unityweb|gz|br)$/, '');
+  if (stripped.endsWith('.wasm')) return 'application/wasm';
+  if (stripped.endsWith('.js')) return 'application/javascript';
+  return 'application/octet-stream';
+};
+
+const detectEncoding = (bytes) => {
+  if (bytes.length > 2 && bytes[0] === 0x1f && bytes[1] === 0x8b) {
+    return 'gzip';
+  }
+  // Unity prefixes brotli output with a metadata block carrying this marker.
+  if (bytes.subarray(0, 64).toString('latin1').includes('UnityWeb Compressed Content (brotli)')) {
+    return 'br';
+  }
+  return 'identity';
+};
+
+const decode = (bytes, encoding) => {
+  switch (encoding) {
+    case 'gzip':
+      return gunzipSync(bytes);
+    case 'br':
+      return brotliDecompressSync(bytes);
+    default:
+      return bytes;
+  }
+};
+
+const files = {};
+for (const name of readdirSync(buildDir).sort()) {
+  if (name.startsWith('.')) {
+    continue;
+  }
+  const bytes = readFileSync(join(buildDir, name));
+  const encoding = detectEncoding(bytes);
+  files[name] = {
+    hash: createHash('sha256').update(bytes).digest('hex'),
+    size: bytes.length,
+    encoding,
+    decodedSize: decode(bytes, encoding).length,
+    contentType: contentTypeFor(name),
+  };
+}
+
+const version = createHash('sha256')
+  .update(Object.values(files).map((entry) => entry.hash).join(''))
+  .digest('hex')
+  .slice(0, 16);
+
+writeFileSync(manifestPath, `${JSON.stringify({ version, files }, null, 2)}\n`);
+console.log(`[unity_build_manifest] ${basename(manifestPath)} version=${version} files=${Object.keys(files).length}`);
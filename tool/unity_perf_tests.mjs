@@ -0,0 +1,101 @@
+// Runs the Unity performance test assemblies (unity_vault/Assets/Tests) in
+// batch mode and folds the Performance Testing results into one JSON summary
+// for regression tracking:
+//
+//   node tool/unity_perf_tests.mjs [--unity path] [--out dir]
+//                                  [--platform editmode|playmode]
+//                                  [--baseline summary.json] [--tolerance 0.15]
+//
+// The editor defaults to $UNITY_EDITOR, then `unity-editor` on PATH. Each
+// platform writes <platform>-results.xml, <platform>-perf.json and a log to
+// --out (default build/unity-perf); summary.json maps test -> sample group ->
+// median. With --baseline, any median that grew by more than --tolerance
+// fails the run.
+import { spawnSync } from 'node:child_process';
+import { existsSync, mkdirSync, readFileSync, writeFileSync } from 'node:fs';
+import { join, resolve } from 'node:path';
+
+const args = process.argv.slice(2);
+const option = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index === -1 ? fallback : args[index + 1];
+};
+
+const unity = option('--unity', process.env.UNITY_EDITOR ?? 'unity-editor');
+const outDir = resolve(option('--out', 'build/unity-perf'));
+const projectPath = resolve('unity_vault');
+const platforms = option('--platform', null) ? [option('--platform')] : ['editmode', 'playmode'];
+const baselinePath = option('--baseline', null);
+const tolerance = Number(option('--tolerance', 0.15));
+
+mkdirSync(outDir, { recursive: true });
+
+const runPlatform = (platform) => {
+  const perfPath = join(outDir, `${platform}-perf.json`);
+  const result = spawnSync(
+    unity,
+    [
+      '-batchmode',
+      '-nographics',
+      '-projectPath', projectPath,
+      '-runTests',
+      '-testPlatform', platform,
+      '-testCategory', 'Performance',
+      '-testResults', join(outDir, `${platform}-results.xml`),
+      '-perfTestResults', perfPath,
+      '-logFile', join(outDir, `${platform}.log`),
+    ],
+    { stdio: 'inherit' },
+  );
+
+  if (result.error) {
+    throw new Error(`could not start Unity (${unity}): ${result.error.message}`);
+  }
+  console.log(`[unity_perf_tests] ${platform} exited with ${result.status}`);
+  return { status: result.status, perfPath };
+};
+
+// Performance Testing writes {Results: [{Name, SampleGroups: [{Name, Unit, Median, ...}]}]}.
+const summarize = (perfPaths) => {
+  const summary = {};
+  for (const path of perfPaths) {
+    if (!existsSync(path)) {
+      continue;
+    }
+    for (const test of JSON.parse(readFileSync(path, 'utf8')).Results ?? []) {
+      const groups = (summary[test.Name] ??= {});
+      for (const group of test.SampleGroups ?? []) {
+        groups[group.Name] = { unit: group.Unit, median: group.Median, min: group.Min, max: group.Max };
+      }
+    }
+  }
+  return summary;
+};
+
+const compare = (summary, baseline) => {
+  const regressions = [];
+  for (const [test, groups] of Object.entries(summary)) {
+    for (const [group, sample] of Object.entries(groups)) {
+      const before = baseline[test]?.[group]?.median;
+      if (before > 0 && sample.median > before * (1 + tolerance)) {
+        const growth = ((sample.median / before - 1) * 100).toFixed(1);
+        regressions.push(`${test} [${group}] ${before} -> ${sample.median} (+${growth}%)`);
+      }
+    }
+  }
+  return regressions;
+};
+
+const runs = platforms.map(runPlatform);
+const summary = summarize(runs.map((run) => run.perfPath));
+const summaryPath = join(outDir, 'summary.json');
+writeFileSync(summaryPath, `${JSON.stringify(summary, null, 2)}\n`);
+console.log(`[unity_perf_tests] ${Object.keys(summary).length} tests -> ${summaryPath}`);
+
+let failed = runs.some((run) => run.status !== 0);
+if (baselinePath) {
+  const regressions = compare(summary, JSON.parse(readFileSync(resolve(baselinePath), 'utf8')));
+  for (const line of regressions) console.error(`  regression: ${line}`);
+  failed ||= regressions.length > 0;
+}
+process.exit(failed ? 1 : 0);
@@ -0,0 +1,305 @@
+// Attributes WebGL code size to il2cpp translation units and assemblies, writes
+// the stripping configuration for a build profile, and enforces its budgets.
+//
+//   node tool/unity_size_report.mjs [--profile path] [--top N] [--json out]
+//                                   [--apply] [--check]
+//
+// Sizes come from the wasm objects Bee compiles for the last WebGL player
+// build (unity_vault/Library/Bee/Player*.dag.json maps each object back to its
+// il2cpp .cpp). They are pre-link code+data section sizes, so absolute numbers
+// overstate the final Build.wasm, but they rank assemblies reliably. When the
+// packaged build is present in web/3d/Build its wasm size is reported too.
+//
+// --apply  rewrites unity_vault/Packages/manifest.json and Assets/link.xml for
+//          the profile: engine module packages the linker report shows as
+//          unused are dropped unless a kept package still depends on them.
+// --check  exits non-zero when any budget in the profile is exceeded, or when
+//          a budgeted assembly is missing from the last player build.
+import { existsSync, readdirSync, readFileSync, statSync, writeFileSync } from 'node:fs';
+import { basename, join, resolve } from 'node:path';
+import { gunzipSync } from 'node:zlib';
+
+const args = process.argv.slice(2);
+const option = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index === -1 ? fallback : args[index + 1];
+};
+const flag = (name) => args.includes(name);
+
+const projectDir = resolve('unity_vault');
+const beeDir = join(projectDir, 'Library/Bee');
+const profilePath = resolve(option('--profile', 'unity_vault/BuildProfiles/vault-minimal.json'));
+const webBuildDir = resolve('web/3d/Build');
+const top = Number(option('--top', 25));
+
+const readJson = (path) => JSON.parse(readFileSync(path, 'utf8'));
+
+// --- wasm object sizes ------------------------------------------------------
+
+const readLeb128 = (bytes, offset) => {
+  let result = 0;
+  let shift = 0;
+  let byte;
+  do {
+    byte = bytes[offset++];
+    result += (byte & 0x7f) * 2 ** shift;
+    shift += 7;
+  } while (byte & 0x80);
+  return [result, offset];
+};
+
+const CODE_SECTION = 10;
+const DATA_SECTION = 11;
+
+const wasmSectionSizes = (path) => {
+  const bytes = readFileSync(path);
+  const sizes = { code: 0, data: 0 };
+  if (bytes.readUInt32LE(0) !== 0x6d736100) {
+    return sizes;
+  }
+
+  let offset = 8;
+  while (offset < bytes.length) {
+    const id = bytes[offset];
+    const [length, contentStart] = readLeb128(bytes, offset + 1);
+    if (id === CODE_SECTION) sizes.code += length;
+    if (id === DATA_SECTION) sizes.data += length;
+    offset = contentStart + length;
+  }
+  return sizes;
+};
+
+// --- object -> translation unit -> assembly ---------------------------------
+
+const latestPlayerDag = () => {
+  const candidates = readdirSync(beeDir)
+    .filter((name) => /^Player.*\.dag\.json$/.test(name))
+    .map((name) => join(beeDir, name))
+    .sort((a, b) => statSync(b).mtimeMs - statSync(a).mtimeMs);
+  if (candidates.length === 0) {
+    throw new Error(`no Player*.dag.json under ${beeDir}; build the WebGL player first`);
+  }
+  return candidates[0];
+};
+
+const assemblyFor = (source) => {
+  const file = basename(source);
+  if (!source.includes('/il2cppOutput/')) {
+    // libil2cpp, bdwgc and zlib objects are the fixed runtime cost.
+    if (source.includes('/libil2cpp/') || file.endsWith('.lump.cpp')) return '(libil2cpp runtime)';
+    if (source.includes('bdwgc')) return '(bdwgc)';
+    if (source.includes('zlib')) return '(zlib)';
+    return '(native)';
+  }
+
+  const stem = file.replace(/\.(cpp|c)$/, '').replace(/(__\d+|_CodeGen)$/, '');
+  if (stem === 'Generics' || stem === 'GenericMethods') return '(shared generics)';
+  if (stem.startsWith('__Generated') || stem.startsWith('Il2Cpp')) return '(il2cpp metadata)';
+  return stem;
+};
+
+const collectUnits = () => {
+  const dag = readJson(latestPlayerDag());
+  const units = [];
+  for (const node of dag.Nodes) {
+    const output = node.Outputs?.[0];
+    if (!output?.endsWith('.o') || !node.Inputs?.length) {
+      continue;
+    }
+    const objectPath = join(projectDir, output);
+    if (!existsSync(objectPath)) {
+      continue;
+    }
+    const source = node.Inputs[0].replace(/\\/g, '/');
+    const { code, data } = wasmSectionSizes(objectPath);
+    units.push({ unit: basename(source), assembly: assemblyFor(source), code, data });
+  }
+  return units;
+};
+
+const groupByAssembly = (units) => {
+  const groups = new Map();
+  for (const unit of units) {
+    const group = groups.get(unit.assembly) ?? { assembly: unit.assembly, units: 0, code: 0, data: 0 };
+    group.units += 1;
+    group.code += unit.code;
+    group.data += unit.data;
+    groups.set(unit.assembly, group);
+  }
+  return [...groups.values()].sort((a, b) => b.code + b.data - (a.code + a.data));
+};
+
+const packagedWasm = () => {
+  if (!existsSync(webBuildDir)) {
+    return null;
+  }
+  const name = readdirSync(webBuildDir).find((file) => /\.wasm(\.unityweb|\.gz)?$/.test(file));
+  if (!name) {
+    return null;
+  }
+  const bytes = readFileSync(join(webBuildDir, name));
+  const decoded = bytes[0] === 0x1f && bytes[1] === 0x8b ? gunzipSync(bytes) : bytes;
+  return { name, transferBytes: bytes.length, decodedBytes: decoded.length };
+};
+
+// --- profile: module stripping and link.xml ---------------------------------
+
+// A module is used when the linker saw a class from it in a scene or script,
+// or it is always required; "Required by X" only counts when X is used.
+const usedEngineModules = () => {
+  const reportPath = join(
+    projectDir,
+    'Library/Bee/artifacts/WebGL/ManagedStripped/UnityLinkerToEditorData.json',
+  );
+  const modules = readJson(reportPath).report.modules;
+  const used = new Set(
+    modules
+      .filter((module) => module.dependencies.some((dep) => dep.dependencyType !== 2))
+      .map((module) => module.name),
+  );
+
+  let changed = true;
+  while (changed) {
+    changed = false;
+    for (const module of modules) {
+      if (used.has(module.name)) continue;
+      const requiredByUsed = module.dependencies.some((dep) => {
+        const match = /^Required by (.+) Module$/.exec(dep.name);
+        return match && used.has(match[1]);
+      });
+      if (requiredByUsed) {
+        used.add(module.name);
+        changed = true;
+      }
+    }
+  }
+  return new Set([...used].map((name) => name.toLowerCase()));
+};
+
+const planPackages = (profile) => {
+  const manifestPath = join(projectDir, 'Packages/manifest.json');
+  const manifest = readJson(manifestPath);
+  const lock = readJson(join(projectDir, 'Packages/packages-lock.json')).dependencies;
+  const used = usedEngineModules();
+  const forced = new Set(profile.keepPackages ?? []);
+
+  const keep = new Set(
+    Object.keys(manifest.dependencies).filter((name) => {
+      const module = /^com\.unity\.modules\.(.+)$/.exec(name);
+      return !module || used.has(module[1]) || forced.has(name);
+    }),
+  );
+
+  // Keep the dependency closure of everything kept so the project still resolves.
+  const blockedBy = new Map();
+  const pending = [...keep];
+  while (pending.length > 0) {
+    const name = pending.pop();
+    for (const dependency of Object.keys(lock[name]?.dependencies ?? {})) {
+      if (!keep.has(dependency) && dependency in manifest.dependencies) {
+        blockedBy.set(dependency, name);
+        keep.add(dependency);
+        pending.push(dependency);
+      }
+    }
+  }
+
+  const dropped = Object.keys(manifest.dependencies).filter((name) => !keep.has(name));
+  return { manifestPath, manifest, keep, dropped, blockedBy };
+};
+
+const linkXml = (profile) => {
+  const assemblies = Object.entries(profile.preserve ?? {})
+    .map(([assembly, types]) => [
+      `  <assembly fullname="${assembly}">`,
+      ...types.map((type) => `    <type fullname="${type}" preserve="all"/>`),
+      '  </assembly>',
+    ].join('\n'))
+    .join('\n');
+  return [
+    '<linker>',
+    `  <!-- Generated by tool/unity_size_report.mjs for the ${profile.name} profile. -->`,
+    assemblies,
+    '</linker>',
+    '',
+  ].join('\n');
+};
+
+// --- report -----------------------------------------------------------------
+
+const kb = (bytes) => `${(bytes / 1024).toFixed(1)} KB`;
+const pad = (value, width) => String(value).padStart(width);
+
+const profile = existsSync(profilePath) ? readJson(profilePath) : { name: 'default', budgets: {} };
+const units = collectUnits();
+const assemblies = groupByAssembly(units);
+const totals = units.reduce((acc, unit) => ({ code: acc.code + unit.code, data: acc.data + unit.data }), {
+  code: 0,
+  data: 0,
+});
+const wasm = packagedWasm();
+
+console.log(`[unity_size_report] ${units.length} objects, code ${kb(totals.code)}, data ${kb(totals.data)}`);
+if (wasm) {
+  console.log(`[unity_size_report] ${wasm.name}: ${kb(wasm.transferBytes)} transfer, ${kb(wasm.decodedBytes)} decoded`);
+}
+console.log(`\n${'assembly'.padEnd(48)} ${pad('units', 5)} ${pad('code', 10)} ${pad('data', 10)} ${pad('share', 6)}`);
+for (const group of assemblies.slice(0, top)) {
+  const share = ((group.code + group.data) / (totals.code + totals.data)) * 100;
+  console.log(
+    `${group.assembly.padEnd(48)} ${pad(group.units, 5)} ${pad(kb(group.code), 10)} ${pad(kb(group.data), 10)} ${pad(share.toFixed(1), 5)}%`,
+  );
+}
+
+const outputPath = option('--json', null);
+if (outputPath) {
+  writeFileSync(resolve(outputPath), `${JSON.stringify({ totals, wasm, assemblies, units }, null, 2)}\n`);
+}
+
+if (flag('--apply')) {
+  const plan = planPackages(profile);
+  const dependencies = Object.fromEntries(
+    Object.entries(plan.manifest.dependencies).filter(([name]) => plan.keep.has(name)),
+  );
+  writeFileSync(plan.manifestPath, `${JSON.stringify({ ...plan.manifest, dependencies }, null, 2)}\n`);
+  const lockPath = join(projectDir, 'Packages/packages-lock.json');
+  const lock = readJson(lockPath);
+  for (const name of plan.dropped) delete lock.dependencies[name];
+  writeFileSync(lockPath, `${JSON.stringify(lock, null, 2)}\n`);
+  writeFileSync(join(projectDir, 'Assets/link.xml'), linkXml(profile));
+  console.log(`\n[unity_size_report] ${profile.name}: dropped ${plan.dropped.length} packages`);
+  for (const name of plan.dropped) console.log(`  - ${name}`);
+  for (const [name, by] of plan.blockedBy) console.log(`  kept ${name} (required by ${by})`);
+}
+
+if (flag('--check')) {
+  const budgets = profile.budgets ?? {};
+  const failures = [];
+  const over = (label, actual, limit) => {
+    if (limit != null && actual > limit) failures.push(`${label}: ${actual} > ${limit}`);
+  };
+
+  over('objectCodeBytes', totals.code, budgets.objectCodeBytes);
+  over('objectDataBytes', totals.data, budgets.objectDataBytes);
+  if (wasm) {
+    over('wasmTransferBytes', wasm.transferBytes, budgets.wasmTransferBytes);
+    over('wasmDecodedBytes', wasm.decodedBytes, budgets.wasmDecodedBytes);
+  }
+  for (const [assembly, limit] of Object.entries(budgets.assemblies ?? {})) {
+    const group = assemblies.find((entry) => entry.assembly === assembly);
+    if (!group) {
+      // A renamed asmdef or a player built before it would otherwise pass as
+      // zero bytes.
+      failures.push(`assembly ${assembly}: not in the last player build; rebuild or rename the budget`);
+      continue;
+    }
+    over(`assembly ${assembly}`, group.code + group.data, limit);
+  }
+
+  if (failures.length > 0) {
+    console.error(`\n[unity_size_report] ${profile.name} budget exceeded:`);
+    for (const failure of failures) console.error(`  ${failure}`);
+    process.exit(1);
+  }
+  console.log(`\n[unity_size_report] ${profile.name} budgets OK`);
+}
@@ -0,0 +1,146 @@
+// Generates synthetic wallet payloads for load-testing the Unity bridge, and
+// summarizes bridge recordings:
+//
+//   node tool/vault_wallet_gen.mjs [--tokens N] [--distribution lognormal|uniform|whale|dust]
+//                                  [--symbols textured|untextured|mixed] [--seed N]
+//                                  [--messages N] [--interval ms] [--reset-every N]
+//                                  [--logo-url template] [--out file]
+//   node tool/vault_wallet_gen.mjs --inspect recording.json
+//
+// A single message is written as a plain WalletMessage ({type: 'setWallet',
+// balances}). With --messages > 1 the output is a recording in the format
+// web/3d/bridge_recorder.js saves: {version, source, events: [{at, type, ...}]},
+// where each wallet push drifts the previous amounts by a few percent. Both
+// recordings replay into the player through BridgeReplay.cs (`?vaultReplay=` on
+// the Flutter URL, or `-vaultReplay <path>` on the command line).
+//
+// --logo-url adds a logoUrl to every balance, with {symbol} replaced, e.g.
+// 'http://localhost:8000/{symbol}.png' to exercise runtime logo loading.
+//
+// Output is fully determined by the arguments and --seed.
+import { readFileSync, writeFileSync } from 'node:fs';
+import { resolve } from 'node:path';
+
+const args = process.argv.slice(2);
+const option = (name, fallback) => {
+  const index = args.indexOf(name);
+  return index === -1 ? fallback : args[index + 1];
+};
+
+// Symbols with a logo under unity_vault/Assets/StreamingAssets/Tokens; anything else
+// spawns with the fallback material and a TextMeshPro label.
+const TEXTURED_SYMBOLS = ['BTC', 'USDC', 'PEPE'];
+
+// mulberry32: small, fast and reproducible across Node versions.
+const createRandom = (seed) => {
+  let state = seed >>> 0;
+  return () => {
+    state = (state + 0x6d2b79f5) >>> 0;
+    let t = state;
+    t = Math.imul(t ^ (t >>> 15), t | 1);
+    t ^= t + Math.imul(t ^ (t >>> 7), t | 61);
+    return ((t ^ (t >>> 14)) >>> 0) / 4294967296;
+  };
+};
+
+const gaussian = (random) => {
+  const u = 1 - random();
+  return Math.sqrt(-2 * Math.log(u)) * Math.cos(2 * Math.PI * random());
+};
+
+const distributions = {
+  // Typical retail wallet: most balances in the hundreds, a long tail upwards.
+  lognormal: (random) => Math.exp(Math.log(500) + 2.5 * gaussian(random)),
+  uniform: (random) => 1 + random() * 99_999,
+  // A handful of nine-figure positions on top of ordinary ones; exercises every divisor tier.
+  whale: (random) => (random() < 0.1 ? 10 ** (6 + random() * 3) : Math.exp(Math.log(200) + 2 * gaussian(random))),
+  // Airdrop leftovers: almost everything rounds to a single coin.
+  dust: (random) => random() ** 3,
+};
+
+const symbolFor = (set, index) => {
+  const synthetic = `T${String(index).padStart(4, '0')}`;
+  if (set === 'textured') return TEXTURED_SYMBOLS[index % TEXTURED_SYMBOLS.length];
+  if (set === 'mixed') return index % 2 === 0 ? TEXTURED_SYMBOLS[(index / 2) % TEXTURED_SYMBOLS.length] : synthetic;
+  return synthetic;
+};
+
+const round = (amount) => Math.round(amount * 1e6) / 1e6;
+
+const generate = () => {
+  const tokens = Number(option('--tokens', 50));
+  const distributionName = option('--distribution', 'lognormal');
+  const symbolSet = option('--symbols', 'mixed');
+  const messages = Number(option('--messages', 1));
+  const interval = Number(option('--interval', 1000));
+  const resetEvery = Number(option('--reset-every', 0));
+  const logoUrl = option('--logo-url', null);
+  const sample = distributions[distributionName];
+  if (!sample) {
+    throw new Error(`unknown distribution ${distributionName}; use ${Object.keys(distributions).join('|')}`);
+  }
+
+  const random = createRandom(Number(option('--seed', 1)));
+  let balances = Array.from({ length: tokens }, (_, index) => {
+    const symbol = symbolFor(symbolSet, index);
+    const balance = { symbol, amount: round(sample(random)) };
+    if (logoUrl) balance.logoUrl = logoUrl.replaceAll('{symbol}', symbol);
+    return balance;
+  });
+
+  if (messages <= 1) {
+    return { type: 'setWallet', balances };
+  }
+
+  const events = [];
+  for (let index = 0; index < messages; index += 1) {
+    const at = index * interval;
+    if (resetEvery > 0 && index > 0 && index % resetEvery === 0) {
+      events.push({ at, type: 'reset' });
+    }
+    events.push({ at, type: 'setWallet', payload: JSON.stringify({ type: 'setWallet', balances }) });
+    balances = balances.map((balance) => ({
+      ...balance,
+      amount: round(balance.amount * (1 + (random() - 0.5) * 0.1)),
+    }));
+  }
+  return {
+    version: 1,
+    source: `synthetic:${distributionName}:${symbolSet}:${tokens}`,
+    events,
+  };
+};
+
+const inspect = (path) => {
+  const recording = JSON.parse(readFileSync(resolve(path), 'utf8'));
+  const events = recording.events ?? [];
+  const counts = {};
+  for (const event of events) counts[event.type] = (counts[event.type] ?? 0) + 1;
+
+  const wallets = events.filter((event) => event.type === 'setWallet');
+  const sizes = wallets.map((event) => event.payload.length).sort((a, b) => a - b);
+  const balances = wallets.map((event) => JSON.parse(event.payload).balances?.length ?? 0);
+  const span = events.length > 0 ? events[events.length - 1].at - events[0].at : 0;
+  const at = (sorted, q) => sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))] ?? 0;
+
+  console.log(`[vault_wallet_gen] ${recording.source ?? 'unknown'}: ${events.length} events over ${Math.round(span)}ms`);
+  for (const [type, count] of Object.entries(counts)) console.log(`  ${type.padEnd(10)} ${count}`);
+  if (wallets.length > 0) {
+    console.log(`  payload bytes p50=${at(sizes, 0.5)} max=${sizes[sizes.length - 1]}`);
+    console.log(`  balances max=${Math.max(...balances)}`);
+  }
+};
+
+const inspectPath = option('--inspect', null);
+if (inspectPath) {
+  inspect(inspectPath);
+} else {
+  const output = `${JSON.stringify(generate(), null, 2)}\n`;
+  const outPath = option('--out', null);
+  if (outPath) {
+    writeFileSync(resolve(outPath), output);
+    console.log(`[vault_wallet_gen] wrote ${outPath}`);
+  } else {
+    process.stdout.write(output);
+  }
+}
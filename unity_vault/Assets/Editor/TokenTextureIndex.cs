@@ -0,0 +1,109 @@
+#nullable enable
+
+using System;
+using System.IO;
+using System.Linq;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEngine;
+using Vault;
+
+namespace BuildTools
+{
+    /// <summary>
+    /// Before every player build, compresses the bundled token logos into the GPU formats of
+    /// <see cref="GpuTextureFile.Formats"/> under <c>StreamingAssets/Tokens/gpu</c> and writes
+    /// <c>Tokens/index.json</c>, the list of logos and formats <see cref="TokenTextureCache"/> may
+    /// request. Logos are named <c>&lt;SYMBOL&gt;.png</c> in upper case, matching the symbols the
+    /// spawner requests.
+    /// </summary>
+    /// <remarks>
+    /// Each logo is resampled to <see cref="LogoSize"/> (the coin face at the closest orbit distance)
+    /// with a full mip chain before compression, so a resident ASTC 6x6 logo takes about 9 KB and a
+    /// DXT5/ETC2 one about 21 KB, against 85 KB for the same logo as RGBA32.
+    /// </remarks>
+    public sealed class TokenTextureIndex : IPreprocessBuildWithReport
+    {
+        [Serializable]
+        private class Index
+        {
+            public string[] symbols = Array.Empty<string>();
+            public string[] formats = Array.Empty<string>();
+        }
+
+        private const int LogoSize = 128;
+
+        private static readonly string TokenFolder = Path.Combine(Application.streamingAssetsPath, "Tokens");
+        private static readonly string GpuFolder = Path.Combine(TokenFolder, "gpu");
+
+        public int callbackOrder => 0;
+
+        public void OnPreprocessBuild(BuildReport report) => Write();
+
+        [MenuItem("Vault/Rebuild Token Textures")]
+        public static void Write()
+        {
+            if (!Directory.Exists(TokenFolder))
+            {
+                return;
+            }
+
+            var sources = Directory.GetFiles(TokenFolder, "*.png")
+                .OrderBy(path => Path.GetFileName(path), StringComparer.Ordinal)
+                .ToArray();
+            Directory.CreateDirectory(GpuFolder);
+
+            var totalBytes = new long[GpuTextureFile.Formats.Length];
+            foreach (var path in sources)
+            {
+                var symbol = Path.GetFileNameWithoutExtension(path).ToUpperInvariant();
+                var resampled = Resample(path);
+                for (var i = 0; i < GpuTextureFile.Formats.Length; i++)
+                {
+                    var (suffix, format) = GpuTextureFile.Formats[i];
+                    var compressed = UnityEngine.Object.Instantiate(resampled);
+                    EditorUtility.CompressTexture(compressed, format, TextureCompressionQuality.Best);
+                    var bytes = GpuTextureFile.Write(compressed);
+                    File.WriteAllBytes(Path.Combine(GpuFolder, $"{symbol}.{suffix}{GpuTextureFile.Extension}"), bytes);
+                    totalBytes[i] += bytes.Length;
+                    UnityEngine.Object.DestroyImmediate(compressed);
+                }
+
+                UnityEngine.Object.DestroyImmediate(resampled);
+            }
+
+            var index = new Index
+            {
+                symbols = sources.Select(path => Path.GetFileNameWithoutExtension(path).ToUpperInvariant()).ToArray(),
+                formats = GpuTextureFile.Formats.Select(entry => entry.Suffix).ToArray(),
+            };
+
+            File.WriteAllText(Path.Combine(TokenFolder, "index.json"), JsonUtility.ToJson(index, true));
+            AssetDatabase.Refresh();
+
+            var sizes = string.Join(", ", GpuTextureFile.Formats.Select((entry, i) => $"{entry.Suffix} {totalBytes[i] / 1024} KB"));
+            Debug.Log($"[TokenTextureIndex] {index.symbols.Length} token textures at {LogoSize}px: {sizes}.");
+        }
+
+        private static Texture2D Resample(string path)
+        {
+            var source = new Texture2D(2, 2, TextureFormat.RGBA32, false);
+            source.LoadImage(File.ReadAllBytes(path));
+
+            var target = RenderTexture.GetTemporary(LogoSize, LogoSize, 0, RenderTextureFormat.ARGB32, RenderTextureReadWrite.sRGB);
+            var previous = RenderTexture.active;
+            Graphics.Blit(source, target);
+            RenderTexture.active = target;
+
+            var resampled = new Texture2D(LogoSize, LogoSize, TextureFormat.RGBA32, true);
+            resampled.ReadPixels(new Rect(0, 0, LogoSize, LogoSize), 0, 0);
+            resampled.Apply(true);
+
+            RenderTexture.active = previous;
+            RenderTexture.ReleaseTemporary(target);
+            UnityEngine.Object.DestroyImmediate(source);
+            return resampled;
+        }
+    }
+}
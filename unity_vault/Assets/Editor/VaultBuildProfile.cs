@@ -0,0 +1,93 @@
+#nullable enable
+
+using System;
+using System.IO;
+using System.Linq;
+using UnityEditor;
+using UnityEditor.Build;
+using UnityEditor.Build.Reporting;
+using UnityEngine;
+
+namespace BuildTools
+{
+    /// <summary>
+    /// Builds the WebGL player with the settings of a profile in <c>BuildProfiles/</c>.
+    /// Run <c>npm run unity:size -- --apply</c> first so the package manifest and link.xml
+    /// match the profile, and <c>npm run unity:size -- --check</c> afterwards to enforce its budgets.
+    /// </summary>
+    public static class VaultBuildProfile
+    {
+        [Serializable]
+        private class Profile
+        {
+            public string name = string.Empty;
+            public PlayerOptions player = new();
+        }
+
+        [Serializable]
+        private class PlayerOptions
+        {
+            public string managedStrippingLevel = nameof(ManagedStrippingLevel.High);
+            public bool stripEngineCode = true;
+            public string il2cppCodeGeneration = nameof(Il2CppCodeGeneration.OptimizeSize);
+        }
+
+        private const string DefaultProfile = "vault-minimal";
+        private const string OutputRoot = "Builds";
+
+        [MenuItem("Vault/Build WebGL (vault-minimal)")]
+        private static void BuildFromMenu() => Build(DefaultProfile);
+
+        /// <summary>
+        /// Batch mode entry point: <c>-executeMethod BuildTools.VaultBuildProfile.BuildMinimal</c>.
+        /// </summary>
+        public static void BuildMinimal()
+        {
+            var report = Build(DefaultProfile);
+            if (Application.isBatchMode)
+            {
+                EditorApplication.Exit(report.summary.result == BuildResult.Succeeded ? 0 : 1);
+            }
+        }
+
+        private static BuildReport Build(string profileName)
+        {
+            var profilePath = Path.Combine("BuildProfiles", profileName + ".json");
+            var profile = JsonUtility.FromJson<Profile>(File.ReadAllText(profilePath));
+            var target = NamedBuildTarget.WebGL;
+
+            var previousStripping = PlayerSettings.GetManagedStrippingLevel(target);
+            var previousStripEngine = PlayerSettings.stripEngineCode;
+            var previousCodeGeneration = PlayerSettings.GetIl2CppCodeGeneration(target);
+
+            try
+            {
+                PlayerSettings.SetManagedStrippingLevel(
+                    target,
+                    Enum.Parse<ManagedStrippingLevel>(profile.player.managedStrippingLevel));
+                PlayerSettings.stripEngineCode = profile.player.stripEngineCode;
+                PlayerSettings.SetIl2CppCodeGeneration(
+                    target,
+                    Enum.Parse<Il2CppCodeGeneration>(profile.player.il2cppCodeGeneration));
+
+                var options = new BuildPlayerOptions
+                {
+                    scenes = EditorBuildSettings.scenes.Where(scene => scene.enabled).Select(scene => scene.path).ToArray(),
+                    locationPathName = Path.Combine(OutputRoot, profile.name),
+                    target = BuildTarget.WebGL,
+                    options = BuildOptions.None,
+                };
+
+                var report = BuildPipeline.BuildPlayer(options);
+                Debug.Log($"[VaultBuildProfile] {profile.name}: {report.summary.result}, {report.summary.totalSize / 1024} KB");
+                return report;
+            }
+            finally
+            {
+                PlayerSettings.SetManagedStrippingLevel(target, previousStripping);
+                PlayerSettings.stripEngineCode = previousStripEngine;
+                PlayerSettings.SetIl2CppCodeGeneration(target, previousCodeGeneration);
+            }
+        }
+    }
+}
@@ -0,0 +1,295 @@
+#nullable enable
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Globalization;
+using System.IO;
+using Messaging;
+using UnityEngine;
+using UnityEngine.Networking;
+using Vault;
+using Debug = UnityEngine.Debug;
+
+namespace Diagnostics
+{
+    /// <summary>
+    /// Replays a bridge recording (web/3d/bridge_recorder.js, or synthetic from
+    /// tool/vault_wallet_gen.mjs) into <see cref="Bridge.SetWalletJSON"/> and reports dispatch and
+    /// first-frame timings. Created automatically when the player URL carries <c>replay=&lt;url&gt;</c>
+    /// or the command line has <c>-vaultReplay &lt;path&gt;</c>.
+    /// </summary>
+    /// <remarks>
+    /// <c>replaySpeed</c> / <c>-vaultReplaySpeed</c> scales the recorded timeline; 0 dispatches the
+    /// next event as soon as the previous one has rendered. Selection events are Unity output and
+    /// are only counted. In batch mode the player quits after writing <c>-vaultReplayStats</c>.
+    /// </remarks>
+    public sealed class BridgeReplay : MonoBehaviour
+    {
+        [SerializeField] private TextAsset? recording;
+        [SerializeField] private float speed = 1f;
+        [SerializeField] private string statsPath = string.Empty;
+
+        [Serializable]
+        private class Recording
+        {
+            public string source = string.Empty;
+            public RecordedEvent[] events = Array.Empty<RecordedEvent>();
+        }
+
+        [Serializable]
+        private class RecordedEvent
+        {
+            public double at;
+            public string type = string.Empty;
+            public string payload = string.Empty;
+            public bool paused;
+        }
+
+        [Serializable]
+        private class ReplayStatsMessage
+        {
+            public string type = "replayStats";
+            public string source = string.Empty;
+            public float speed;
+            public int wallets;
+            public int resets;
+            public int pauses;
+            public int selections;
+            public float recordedMs;
+            public float elapsedMs;
+            public float dispatchP50;
+            public float dispatchP95;
+            public float dispatchMax;
+            public float frameP50;
+            public float frameP95;
+            public float frameMax;
+            public int peakCoins;
+        }
+
+        private readonly List<float> _dispatchMs = new();
+        private readonly List<float> _frameMs = new();
+        private readonly ReplayStatsMessage _stats = new();
+
+        private string _source = string.Empty;
+        private CoinSpawner? _spawner;
+        private int _sampleFrame = -1;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+        private static void Bootstrap()
+        {
+            var source = QueryParameter("replay") ?? CommandLineArgument("-vaultReplay");
+            if (string.IsNullOrEmpty(source) || FindAnyObjectByType<BridgeReplay>() != null)
+            {
+                return;
+            }
+
+            var host = new GameObject(nameof(BridgeReplay));
+            DontDestroyOnLoad(host);
+            var replay = host.AddComponent<BridgeReplay>();
+            replay._source = source!;
+            replay.statsPath = CommandLineArgument("-vaultReplayStats") ?? string.Empty;
+
+            var speedArgument = QueryParameter("replaySpeed") ?? CommandLineArgument("-vaultReplaySpeed");
+            if (float.TryParse(speedArgument, NumberStyles.Float, CultureInfo.InvariantCulture, out var speed))
+            {
+                replay.speed = Mathf.Max(0f, speed);
+            }
+        }
+
+        private IEnumerator Start()
+        {
+            var json = recording != null ? recording.text : null;
+            if (json == null && !string.IsNullOrEmpty(_source))
+            {
+                if (Application.platform == RuntimePlatform.WebGLPlayer || _source.Contains("://"))
+                {
+                    var url = Application.platform == RuntimePlatform.WebGLPlayer
+                        ? new Uri(new Uri(Application.absoluteURL), _source).ToString()
+                        : _source;
+                    using var request = UnityWebRequest.Get(url);
+                    yield return request.SendWebRequest();
+                    if (request.result != UnityWebRequest.Result.Success)
+                    {
+                        Debug.LogError($"[BridgeReplay] Could not load {url}: {request.error}");
+                        yield break;
+                    }
+
+                    json = request.downloadHandler.text;
+                }
+                else
+                {
+                    json = File.ReadAllText(_source);
+                }
+            }
+
+            var parsed = string.IsNullOrEmpty(json) ? null : JsonUtility.FromJson<Recording>(json);
+            if (parsed == null || parsed.events.Length == 0)
+            {
+                Debug.LogWarning("[BridgeReplay] Recording has no events.");
+                yield break;
+            }
+
+            _spawner = FindAnyObjectByType<CoinSpawner>();
+            _stats.source = string.IsNullOrEmpty(parsed.source) ? _source : parsed.source;
+            _stats.speed = speed;
+            yield return Play(parsed.events);
+            Finish(parsed.events);
+        }
+
+        private IEnumerator Play(RecordedEvent[] events)
+        {
+            var origin = events[0].at;
+            var clock = Stopwatch.StartNew();
+            for (var i = 0; i < events.Length; i++)
+            {
+                var next = events[i];
+                if (speed > 0f)
+                {
+                    while (clock.Elapsed.TotalMilliseconds * speed < next.at - origin)
+                    {
+                        yield return null;
+                    }
+                }
+                else
+                {
+                    // Let the previous dispatch render so its first-frame sample is not shared.
+                    while (_sampleFrame >= 0)
+                    {
+                        yield return null;
+                    }
+                }
+
+                Dispatch(next);
+            }
+
+            while (_sampleFrame >= 0)
+            {
+                yield return null;
+            }
+
+            _stats.elapsedMs = (float)clock.Elapsed.TotalMilliseconds;
+        }
+
+        private void Dispatch(RecordedEvent recorded)
+        {
+            switch (recorded.type)
+            {
+                case "setWallet":
+                    var started = Stopwatch.GetTimestamp();
+                    Bridge.SetWalletJSON(recorded.payload);
+                    _dispatchMs.Add((float)((Stopwatch.GetTimestamp() - started) * 1000d / Stopwatch.Frequency));
+                    _stats.wallets++;
+                    if (_spawner != null)
+                    {
+                        _stats.peakCoins = Mathf.Max(_stats.peakCoins, _spawner.ActiveCoinCount);
+                    }
+
+                    // Coroutines resume after Update, so the frame that first simulates and renders
+                    // the new coins ends when Update of the frame after next begins.
+                    _sampleFrame = Time.frameCount + 2;
+                    break;
+                case "reset":
+                    Bridge.RequestReset();
+                    _stats.resets++;
+                    break;
+                case "pause":
+                    Bridge.SetPaused(recorded.paused);
+                    _stats.pauses++;
+                    break;
+                case "selection":
+                    _stats.selections++;
+                    break;
+                default:
+                    Debug.LogWarning($"[BridgeReplay] Skipping unknown event type: {recorded.type}");
+                    break;
+            }
+        }
+
+        private void Update()
+        {
+            if (_sampleFrame >= 0 && Time.frameCount >= _sampleFrame)
+            {
+                _frameMs.Add(Time.unscaledDeltaTime * 1000f);
+                _sampleFrame = -1;
+            }
+        }
+
+        private void Finish(RecordedEvent[] events)
+        {
+            _stats.recordedMs = (float)(events[events.Length - 1].at - events[0].at);
+            _stats.dispatchP50 = Percentile(_dispatchMs, 0.5f);
+            _stats.dispatchP95 = Percentile(_dispatchMs, 0.95f);
+            _stats.dispatchMax = Percentile(_dispatchMs, 1f);
+            _stats.frameP50 = Percentile(_frameMs, 0.5f);
+            _stats.frameP95 = Percentile(_frameMs, 0.95f);
+            _stats.frameMax = Percentile(_frameMs, 1f);
+
+            Debug.Log(
+                $"[BridgeReplay] {_stats.source} x{_stats.speed}: {_stats.wallets} wallets in {_stats.elapsedMs:F0} ms " +
+                $"(recorded {_stats.recordedMs:F0} ms), dispatch p50 {_stats.dispatchP50:F2} p95 {_stats.dispatchP95:F2} " +
+                $"max {_stats.dispatchMax:F2} ms, first frame p50 {_stats.frameP50:F2} p95 {_stats.frameP95:F2} ms, " +
+                $"peak coins {_stats.peakCoins}");
+            Bridge.PostToParent(_stats);
+
+            if (!string.IsNullOrEmpty(statsPath))
+            {
+                File.WriteAllText(statsPath, JsonUtility.ToJson(_stats, true));
+            }
+
+            if (Application.isBatchMode)
+            {
+                Application.Quit();
+            }
+        }
+
+        private static float Percentile(List<float> samples, float quantile)
+        {
+            if (samples.Count == 0)
+            {
+                return 0f;
+            }
+
+            var sorted = new List<float>(samples);
+            sorted.Sort();
+            var index = Mathf.Clamp(Mathf.FloorToInt(quantile * sorted.Count), 0, sorted.Count - 1);
+            return sorted[index];
+        }
+
+        private static string? QueryParameter(string name)
+        {
+            var url = Application.absoluteURL;
+            var query = url.IndexOf('?');
+            if (query < 0)
+            {
+                return null;
+            }
+
+            foreach (var pair in url.Substring(query + 1).Split('&', '#'))
+            {
+                var separator = pair.IndexOf('=');
+                if (separator > 0 && string.Equals(pair.Substring(0, separator), name, StringComparison.Ordinal))
+                {
+                    return Uri.UnescapeDataString(pair.Substring(separator + 1));
+                }
+            }
+
+            return null;
+        }
+
+        private static string? CommandLineArgument(string name)
+        {
+            var args = Environment.GetCommandLineArgs();
+            for (var i = 0; i < args.Length - 1; i++)
+            {
+                if (string.Equals(args[i], name, StringComparison.Ordinal))
+                {
+                    return args[i + 1];
+                }
+            }
+
+            return null;
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#nullable enable
+
+using System;
+using Messaging;
+using Unity.Profiling;
+using UnityEngine;
+using Vault;
+
+namespace Diagnostics
+{
+    /// <summary>
+    /// Records per-frame timings with <see cref="ProfilerRecorder"/>, keeps rolling percentiles over
+    /// the last few seconds, and periodically posts a compact <c>frameStats</c> message to the host.
+    /// Created automatically after the first scene loads. The overlay is shown when the player URL
+    /// carries <c>hud=1</c>.
+    /// </summary>
+    public sealed class PerfSampler : MonoBehaviour
+    {
+        [SerializeField] private float reportInterval = 2f;
+        [SerializeField] private bool showOverlay;
+
+        private const int WindowSize = 240;
+        private const double NanosecondsPerMillisecond = 1_000_000d;
+
+        [Serializable]
+        private class FrameStatsMessage
+        {
+            public string type = "frameStats";
+            public int frames;
+            public float frameP50;
+            public float frameP95;
+            public float mainP50;
+            public float mainP95;
+            public float physicsP95;
+            public float renderP95;
+            public long gcAllocBytes;
+            public int coins;
+            public int batches;
+            public int instancedBatches;
+            public int logoTextures;
+            public long logoBytes;
+            public string logoFormat = string.Empty;
+            public int logoDecodes;
+            public float logoDecodeMsMax;
+            public int coinTriangles;
+            public int coinsReduced;
+            public int coinsImpostor;
+            public int coinsHidden;
+        }
+
+        private readonly RollingWindow _frameMs = new(WindowSize);
+        private readonly RollingWindow _mainMs = new(WindowSize);
+        private readonly RollingWindow _physicsMs = new(WindowSize);
+        private readonly RollingWindow _renderMs = new(WindowSize);
+        private readonly FrameStatsMessage _message = new();
+
+        private ProfilerRecorder _mainThread;
+        private ProfilerRecorder _physics;
+        private ProfilerRecorder _render;
+        private ProfilerRecorder _gcAlloc;
+        private ProfilerRecorder _batches;
+        private ProfilerRecorder _instancedBatches;
+
+        private CoinSpawner? _spawner;
+        private long _gcAllocSinceReport;
+        private float _nextReportAt;
+
+        [RuntimeInitializeOnLoadMethod(RuntimeInitializeLoadType.AfterSceneLoad)]
+        private static void Bootstrap()
+        {
+            if (FindAnyObjectByType<PerfSampler>() != null)
+            {
+                return;
+            }
+
+            var host = new GameObject(nameof(PerfSampler));
+            DontDestroyOnLoad(host);
+            host.AddComponent<PerfSampler>();
+        }
+
+        private void OnEnable()
+        {
+            showOverlay |= Application.absoluteURL.Contains("hud=1");
+
+            // Markers that are not available in this player (e.g. release-only builds) stay invalid
+            // and report zero.
+            _mainThread = ProfilerRecorder.StartNew(ProfilerCategory.Internal, "Main Thread", 1);
+            _physics = ProfilerRecorder.StartNew(ProfilerCategory.Physics, "Physics.Simulate", 1);
+            _render = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Camera.Render", 1);
+            _gcAlloc = ProfilerRecorder.StartNew(ProfilerCategory.Memory, "GC Allocated In Frame", 1);
+            _batches = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Batches Count", 1);
+            _instancedBatches = ProfilerRecorder.StartNew(ProfilerCategory.Render, "Instanced Batched Draw Calls Count", 1);
+            _nextReportAt = Time.unscaledTime + reportInterval;
+        }
+
+        private void OnDisable()
+        {
+            _mainThread.Dispose();
+            _physics.Dispose();
+            _render.Dispose();
+            _gcAlloc.Dispose();
+            _batches.Dispose();
+            _instancedBatches.Dispose();
+        }
+
+        private void Update()
+        {
+            _frameMs.Add(Time.unscaledDeltaTime * 1000f);
+            _mainMs.Add(Milliseconds(_mainThread));
+            _physicsMs.Add(Milliseconds(_physics));
+            _renderMs.Add(Milliseconds(_render));
+            _gcAllocSinceReport += LastValue(_gcAlloc);
+
+            if (Time.unscaledTime >= _nextReportAt)
+            {
+                _nextReportAt = Time.unscaledTime + reportInterval;
+                Report();
+            }
+        }
+
+        private void Report()
+        {
+            if (_spawner == null)
+            {
+                _spawner = FindAnyObjectByType<CoinSpawner>();
+            }
+
+            _message.frames = _frameMs.Count;
+            _message.frameP50 = _frameMs.Percentile(0.5f);
+            _message.frameP95 = _frameMs.Percentile(0.95f);
+            _message.mainP50 = _mainMs.Percentile(0.5f);
+            _message.mainP95 = _mainMs.Percentile(0.95f);
+            _message.physicsP95 = _physicsMs.Percentile(0.95f);
+            _message.renderP95 = _renderMs.Percentile(0.95f);
+            _message.gcAllocBytes = _gcAllocSinceReport;
+            _message.coins = _spawner != null ? _spawner.ActiveCoinCount : 0;
+            _message.batches = (int)LastValue(_batches);
+            _message.instancedBatches = (int)LastValue(_instancedBatches);
+            var textures = _spawner != null ? _spawner.Textures : null;
+            if (textures != null)
+            {
+                textures.TakeDecodeStats(out _message.logoDecodes, out _, out _message.logoDecodeMsMax);
+                _message.logoTextures = textures.ResidentCount;
+                _message.logoBytes = textures.ResidentBytes;
+                _message.logoFormat = textures.BundledFormat;
+            }
+            var lod = _spawner != null ? _spawner.Lod : null;
+            if (lod != null)
+            {
+                _message.coinTriangles = lod.Triangles;
+                _message.coinsReduced = lod.CountAt(CoinLod.Reduced);
+                _message.coinsImpostor = lod.CountAt(CoinLod.Impostor);
+                _message.coinsHidden = lod.HiddenCount;
+            }
+            _gcAllocSinceReport = 0;
+
+            Bridge.PostToParent(_message);
+        }
+
+        private void OnGUI()
+        {
+            if (!showOverlay)
+            {
+                return;
+            }
+
+            GUI.Label(
+                new Rect(12f, 12f, 360f, 120f),
+                $"frame p50 {_message.frameP50:F1} ms  p95 {_message.frameP95:F1} ms\n" +
+                $"main p95 {_message.mainP95:F1}  physics p95 {_message.physicsP95:F1}  render p95 {_message.renderP95:F1}\n" +
+                $"coins {_message.coins}  batches {_message.batches}  gc {_message.gcAllocBytes / 1024} KB\n" +
+                $"logos {_message.logoTextures} ({_message.logoFormat}, {_message.logoBytes / 1024} KB)  decode max {_message.logoDecodeMsMax:F1} ms\n" +
+                $"coin tris {_message.coinTriangles / 1000}k  reduced {_message.coinsReduced}  impostor {_message.coinsImpostor}  hidden {_message.coinsHidden}");
+        }
+
+        private static long LastValue(ProfilerRecorder recorder) => recorder.Valid ? recorder.LastValue : 0L;
+
+        private static float Milliseconds(ProfilerRecorder recorder) =>
+            (float)(LastValue(recorder) / NanosecondsPerMillisecond);
+
+        /// <summary>
+        /// Fixed-size sample window with allocation-free percentile queries.
+        /// </summary>
+        private sealed class RollingWindow
+        {
+            private readonly float[] _samples;
+            private readonly float[] _sorted;
+            private int _next;
+
+            public RollingWindow(int size)
+            {
+                _samples = new float[size];
+                _sorted = new float[size];
+            }
+
+            public int Count { get; private set; }
+
+            public void Add(float value)
+            {
+                _samples[_next] = value;
+                _next = (_next + 1) % _samples.Length;
+                Count = Mathf.Min(Count + 1, _samples.Length);
+            }
+
+            public float Percentile(float quantile)
+            {
+                if (Count == 0)
+                {
+                    return 0f;
+                }
+
+                Array.Copy(_samples, _sorted, Count);
+                Array.Sort(_sorted, 0, Count);
+                var index = Mathf.Clamp(Mathf.FloorToInt(quantile * Count), 0, Count - 1);
+                return _sorted[index];
+            }
+        }
+    }
+}
@@ -1,3 +1,7 @@
+#nullable enable
+
+using Interaction;
+using Messaging;
 using UnityEngine;
 #if ENABLE_INPUT_SYSTEM
 using UnityEngine.InputSystem;
@@ -6,7 +10,8 @@ using UnityEngine.InputSystem;
 namespace CameraRig
 {
     /// <summary>
-    /// Simple orbit camera suitable for WebGL builds.
+    /// Simple orbit camera suitable for WebGL builds. Clicking a coin moves the orbit centre onto
+    /// it (clicking it again returns to the pivot); focus changes are reported to the host.
     /// </summary>
     public class OrbitCamera : MonoBehaviour
     {
@@ -19,6 +24,8 @@ namespace CameraRig
         [SerializeField] private float pitchSensitivity = 0.2f;
         [SerializeField] private float zoomSensitivity = 2f;
         [SerializeField] private float smoothing = 0.15f;
+        [SerializeField] private bool focusOnSelection = true;
+        [SerializeField] private float focusSmoothing = 0.25f;
 
         private Vector2 _targetAngles;
         private Vector2 _currentAngles;
@@ -26,12 +33,27 @@ namespace CameraRig
         private float _currentDistance;
         private Vector2 _angleVelocity;
         private float _zoomVelocity;
+        private CoinSelectable? _focus;
+        private bool _hasFocus;
+        private Vector3 _currentCenter;
+        private Vector3 _centerVelocity;
+
+        private void OnEnable()
+        {
+            CoinSelectable.Selected += HandleCoinSelected;
+        }
+
+        private void OnDisable()
+        {
+            CoinSelectable.Selected -= HandleCoinSelected;
+        }
 
         private void Start()
         {
             var euler = transform.eulerAngles;
             _currentAngles = _targetAngles = new Vector2(NormalizeAngle(euler.x), NormalizeAngle(euler.y));
             _currentDistance = _targetDistance = Mathf.Clamp(distance, minDistance, maxDistance);
+            _currentCenter = pivot != null ? pivot.position : Vector3.zero;
         }
 
         private void LateUpdate()
@@ -43,12 +65,20 @@ namespace CameraRig
 
             HandleInput();
 
+            // Focused coins are destroyed when the wallet changes; fall back to the pivot.
+            if (_hasFocus && _focus == null)
+            {
+                SetFocus(null);
+            }
+
+            var center = _focus != null ? _focus.transform.position : pivot.position;
+            _currentCenter = Vector3.SmoothDamp(_currentCenter, center, ref _centerVelocity, focusSmoothing);
             _currentAngles = Vector2.SmoothDamp(_currentAngles, _targetAngles, ref _angleVelocity, smoothing);
             _currentDistance = Mathf.SmoothDamp(_currentDistance, _targetDistance, ref _zoomVelocity, smoothing);
 
             var rotation = Quaternion.Euler(_currentAngles.x, _currentAngles.y, 0f);
             var offset = rotation * new Vector3(0f, 0f, -_currentDistance);
-            transform.position = pivot.position + offset;
+            transform.position = _currentCenter + offset;
             transform.rotation = rotation;
         }
 
@@ -117,6 +147,31 @@ namespace CameraRig
             _targetDistance = Mathf.Clamp(_targetDistance, minDistance, maxDistance);
         }
 
+        private void HandleCoinSelected(CoinSelectable coin)
+        {
+            if (!focusOnSelection)
+            {
+                return;
+            }
+
+            SetFocus(_hasFocus && coin == _focus ? null : coin);
+        }
+
+        private void SetFocus(CoinSelectable? coin)
+        {
+            _hasFocus = coin != null;
+            _focus = coin;
+
+            if (coin != null)
+            {
+                coin.Report(SelectionEventKind.CameraFocus);
+            }
+            else
+            {
+                SelectionEventBuffer.Write(SelectionEventKind.CameraFocus, -1, 0, 0, 0);
+            }
+        }
+
         private static float NormalizeAngle(float angle)
         {
             while (angle > 180f) angle -= 360f;
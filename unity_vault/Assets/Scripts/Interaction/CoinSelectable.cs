@@ -1,5 +1,6 @@
 #nullable enable
 
+using System;
 using Messaging;
 using UnityEngine;
 using UnityEngine.EventSystems;
@@ -23,8 +24,16 @@ namespace Interaction
 
         private static readonly int EmissionColorId = Shader.PropertyToID("_EmissionColor");
 
+        /// <summary>
+        /// Raised when any coin is clicked; the orbit camera uses it to change focus.
+        /// </summary>
+        public static event Action<CoinSelectable>? Selected;
+
         public string Symbol { get; private set; } = string.Empty;
         public int CountPerCoin { get; private set; }
+        public int SymbolId { get; private set; }
+        public int Tier { get; private set; }
+        public int CoinIndex { get; private set; }
 
         private void Awake()
         {
@@ -37,6 +46,12 @@ namespace Interaction
             EnsureEmissionKeyword();
         }
 
+        private void OnDestroy()
+        {
+            // Coins are destroyed on every wallet update; close the hover so the host tooltip clears.
+            SetHover(false);
+        }
+
         private void Update()
         {
             var target = _hovering ? 1f : 0f;
@@ -47,27 +62,79 @@ namespace Interaction
         /// <summary>
         /// Assigns runtime data for the coin instance.
         /// </summary>
-        public void Configure(string symbol, int countPerCoin)
+        public void Configure(string symbol, int countPerCoin, int symbolId, int tier, int coinIndex)
         {
             Symbol = symbol;
             CountPerCoin = countPerCoin;
+            SymbolId = symbolId;
+            Tier = tier;
+            CoinIndex = coinIndex;
         }
 
         public void OnPointerEnter(PointerEventData eventData) => SetHover(true);
         public void OnPointerExit(PointerEventData eventData) => SetHover(false);
 
-        public void OnPointerClick(PointerEventData eventData)
+        public void OnPointerClick(PointerEventData eventData) => Select();
+
+        // The project enables both input backends, so with a PhysicsRaycaster the EventSystem
+        // and the legacy OnMouse* messages would each deliver the same click.
+        private void OnMouseEnter()
+        {
+            if (!PointerEventsDelivered())
+            {
+                SetHover(true);
+            }
+        }
+
+        private void OnMouseExit()
         {
-            Bridge.PostCoinSelection(Symbol, CountPerCoin);
+            if (!PointerEventsDelivered())
+            {
+                SetHover(false);
+            }
         }
 
-        private void OnMouseEnter() => SetHover(true);
-        private void OnMouseExit() => SetHover(false);
-        private void OnMouseDown() => Bridge.PostCoinSelection(Symbol, CountPerCoin);
+        private void OnMouseDown()
+        {
+            if (!PointerEventsDelivered())
+            {
+                Select();
+            }
+        }
+
+        /// <summary>
+        /// Whether an active EventSystem raycasts into the scene and so sends this coin pointer events.
+        /// </summary>
+        private static bool PointerEventsDelivered()
+        {
+            var eventSystem = EventSystem.current;
+            return eventSystem != null && eventSystem.isActiveAndEnabled
+                && FindAnyObjectByType<PhysicsRaycaster>() != null;
+        }
 
         public void SetHover(bool hover)
         {
+            if (_hovering == hover)
+            {
+                return;
+            }
+
             _hovering = hover;
+            Report(hover ? SelectionEventKind.HoverEnter : SelectionEventKind.HoverExit);
+        }
+
+        private void Select()
+        {
+            Report(SelectionEventKind.Selected);
+            Selected?.Invoke(this);
+        }
+
+        /// <summary>
+        /// Writes an interaction event for this coin to the host event ring.
+        /// </summary>
+        public void Report(SelectionEventKind kind)
+        {
+            SelectionEventBuffer.Write(kind, SymbolId, CountPerCoin, Tier, CoinIndex);
         }
 
         private void ApplyHighlight(float weight)
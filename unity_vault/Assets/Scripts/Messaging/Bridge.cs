@@ -2,6 +2,7 @@
 
 using System;
 using System.Runtime.InteropServices;
+using AOT;
 using UnityEngine;
 
 namespace Messaging
@@ -13,34 +14,39 @@ namespace Messaging
     {
         public static event Action<Wallet.WalletMessage>? OnWalletUpdated;
         public static event Action? OnResetRequested;
+        public static event Action<bool>? OnPauseChanged;
 
         private static Bridge? _instance;
         private static Wallet.WalletMessage? _lastWalletMessage;
+        private static bool _paused;
+        private static bool _walletPendingResume;
+        private static float _timeScaleBeforePause = 1f;
 
         public static Wallet.WalletMessage? LatestWalletMessage => _lastWalletMessage;
+        public static bool IsPaused => _paused;
+
+        private delegate void PayloadCallback(IntPtr utf8);
+        private delegate void SignalCallback();
+        private delegate void StateCallback(int state);
 
 #if UNITY_WEBGL && !UNITY_EDITOR
         [DllImport("__Internal")]
-        private static extern void RegisterBridgeReceiver(string objectName, string walletMethod, string resetMethod);
+        private static extern void RegisterBridgeCallbacks(PayloadCallback wallet, SignalCallback reset, StateCallback pause);
 
         [DllImport("__Internal")]
         private static extern void SendToParent(string payloadJson);
+
+        [DllImport("__Internal")]
+        private static extern void MarkHostTiming(string name);
 #else
-        private static void RegisterBridgeReceiver(string objectName, string walletMethod, string resetMethod) {}
+        private static void RegisterBridgeCallbacks(PayloadCallback wallet, SignalCallback reset, StateCallback pause) {}
         private static void SendToParent(string payloadJson)
         {
             Debug.Log($"[Bridge] Would post to parent: {payloadJson}");
         }
+        private static void MarkHostTiming(string name) {}
 #endif
 
-        [Serializable]
-        private class CoinSelectionMessage
-        {
-            public string type = "coinSelected";
-            public string symbol = string.Empty;
-            public int count_per_coin;
-        }
-
         private void Awake()
         {
             if (_instance != null && _instance != this)
@@ -54,6 +60,7 @@ namespace Messaging
             DontDestroyOnLoad(gameObject);
 
             TryRegisterWithJavaScript();
+            SelectionEventBuffer.Register();
         }
 
         private void Start()
@@ -64,11 +71,16 @@ namespace Messaging
             }
         }
 
+        private void LateUpdate()
+        {
+            SelectionEventBuffer.Publish();
+        }
+
         private void TryRegisterWithJavaScript()
         {
             try
             {
-                RegisterBridgeReceiver(gameObject.name, nameof(HandleWalletJSON), nameof(HandleResetRequest));
+                RegisterBridgeCallbacks(ReceiveWallet, ReceiveReset, ReceivePause);
             }
             catch (Exception ex)
             {
@@ -77,19 +89,65 @@ namespace Messaging
         }
 
         /// <summary>
-        /// Called by the WebGL JS layer using SendMessage.
+        /// Called directly by the WebGL JS layer with a UTF-8 wallet payload owned by the caller.
+        /// </summary>
+        /// <param name="utf8">Pointer to the NUL-terminated wallet JSON.</param>
+        [MonoPInvokeCallback(typeof(PayloadCallback))]
+        private static void ReceiveWallet(IntPtr utf8) => SetWalletJSON(Marshal.PtrToStringUTF8(utf8) ?? string.Empty);
+
+        /// <summary>
+        /// Called by the JS helper to force-clear the scene.
+        /// </summary>
+        [MonoPInvokeCallback(typeof(SignalCallback))]
+        private static void ReceiveReset() => RequestReset();
+
+        /// <summary>
+        /// Called by the JS helper when the host page hides or reveals the player.
         /// </summary>
-        /// <param name="json">Wallet payload JSON.</param>
-        public void HandleWalletJSON(string json)
+        /// <param name="state">1 to pause, 0 to resume.</param>
+        [MonoPInvokeCallback(typeof(StateCallback))]
+        private static void ReceivePause(int state) => SetPaused(state != 0);
+
+        /// <summary>
+        /// Freezes simulation and audio while the player is not visible. Wallet updates received
+        /// while paused are held back and applied once on resume.
+        /// </summary>
+        /// <param name="paused">True to suspend, false to resume.</param>
+        public static void SetPaused(bool paused)
         {
-            SetWalletJSON(json);
+            if (_paused == paused)
+            {
+                return;
+            }
+
+            _paused = paused;
+            if (paused)
+            {
+                _timeScaleBeforePause = Time.timeScale;
+                Time.timeScale = 0f;
+                Physics.simulationMode = SimulationMode.Script;
+                AudioListener.pause = true;
+            }
+            else
+            {
+                Time.timeScale = _timeScaleBeforePause;
+                Physics.simulationMode = SimulationMode.FixedUpdate;
+                AudioListener.pause = false;
+            }
+
+            OnPauseChanged?.Invoke(paused);
+
+            if (!paused && _walletPendingResume && _lastWalletMessage != null)
+            {
+                _walletPendingResume = false;
+                OnWalletUpdated?.Invoke(_lastWalletMessage);
+            }
         }
 
         /// <summary>
-        /// Called by the JS helper to force-clear the scene.
+        /// Raises <see cref="OnResetRequested"/> as if the host had asked to clear the scene.
         /// </summary>
-        /// <param name="_">Unused payload.</param>
-        public void HandleResetRequest(string _) => OnResetRequested?.Invoke();
+        public static void RequestReset() => OnResetRequested?.Invoke();
 
         /// <summary>
         /// Parses the wallet payload and raises the OnWalletUpdated event.
@@ -118,6 +176,12 @@ namespace Messaging
                 }
 
                 _lastWalletMessage = message;
+                if (_paused)
+                {
+                    _walletPendingResume = true;
+                    return;
+                }
+
                 OnWalletUpdated?.Invoke(message);
             }
             catch (Exception ex)
@@ -156,24 +220,17 @@ namespace Messaging
         }
 
         /// <summary>
-        /// Convenience helper for coin selection events.
+        /// Reports a named startup milestone to the host's cold-start timeline.
         /// </summary>
-        /// <param name="symbol">Token symbol in uppercase.</param>
-        /// <param name="countPerCoin">Aggregated count that the coin represents.</param>
-        public static void PostCoinSelection(string symbol, int countPerCoin)
+        /// <param name="name">Milestone name, e.g. "firstCoin".</param>
+        public static void PostTiming(string name)
         {
-            if (string.IsNullOrWhiteSpace(symbol))
+            if (string.IsNullOrWhiteSpace(name))
             {
                 return;
             }
 
-            var payload = new CoinSelectionMessage
-            {
-                symbol = symbol,
-                count_per_coin = Mathf.Max(0, countPerCoin),
-            };
-
-            PostToParent(payload);
+            MarkHostTiming(name);
         }
     }
 }
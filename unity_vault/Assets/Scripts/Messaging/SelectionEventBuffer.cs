@@ -0,0 +1,92 @@
+#nullable enable
+
+using System;
+using System.Runtime.InteropServices;
+using UnityEngine;
+
+namespace Messaging
+{
+    public enum SelectionEventKind
+    {
+        Selected = 1,
+        HoverEnter = 2,
+        HoverExit = 3,
+        CameraFocus = 4,
+    }
+
+    /// <summary>
+    /// Fixed-layout ring of coin interaction events in pinned memory that the host page reads
+    /// straight out of the wasm heap. Writing an event only stores six ints, so clicks and
+    /// hover streaming cost no managed allocations, JSON, or string marshalling.
+    /// </summary>
+    /// <remarks>
+    /// Slot layout (int32): kind, symbolId, countPerCoin, tier, coinIndex, frame.
+    /// <c>symbolId</c> is the index of the balance in the last wallet payload, or -1 for a
+    /// <see cref="SelectionEventKind.CameraFocus"/> event that clears the focus. The host keeps
+    /// its own read cursor against the published sequence; events older than
+    /// <see cref="Capacity"/> are overwritten.
+    /// </remarks>
+    public static class SelectionEventBuffer
+    {
+        public const int Capacity = 64;
+        public const int Stride = 6;
+
+        private static readonly int[] Slots = new int[Capacity * Stride];
+        private static GCHandle _handle;
+        private static int _sequence;
+        private static int _publishedSequence;
+
+#if UNITY_WEBGL && !UNITY_EDITOR
+        [DllImport("__Internal")]
+        private static extern void RegisterSelectionBuffer(IntPtr slots, int capacity, int stride);
+
+        [DllImport("__Internal")]
+        private static extern void PublishSelectionEvents(int sequence);
+#else
+        private static void RegisterSelectionBuffer(IntPtr slots, int capacity, int stride) {}
+        private static void PublishSelectionEvents(int sequence) {}
+#endif
+
+        /// <summary>
+        /// Pins the ring and hands its address to the JS layer. Safe to call more than once.
+        /// </summary>
+        public static void Register()
+        {
+            if (!_handle.IsAllocated)
+            {
+                _handle = GCHandle.Alloc(Slots, GCHandleType.Pinned);
+            }
+
+            RegisterSelectionBuffer(_handle.AddrOfPinnedObject(), Capacity, Stride);
+        }
+
+        /// <summary>
+        /// Records an event; it becomes visible to the host on the next <see cref="Publish"/>.
+        /// </summary>
+        public static void Write(SelectionEventKind kind, int symbolId, int countPerCoin, int tier, int coinIndex)
+        {
+            var offset = (_sequence % Capacity) * Stride;
+            Slots[offset] = (int)kind;
+            Slots[offset + 1] = symbolId;
+            Slots[offset + 2] = countPerCoin;
+            Slots[offset + 3] = tier;
+            Slots[offset + 4] = coinIndex;
+            Slots[offset + 5] = Time.frameCount;
+            _sequence++;
+        }
+
+        /// <summary>
+        /// Notifies the host of events written since the last call. Called once per frame by the bridge.
+        /// </summary>
+        public static void Publish()
+        {
+            if (_publishedSequence == _sequence)
+            {
+                return;
+            }
+
+            _publishedSequence = _sequence;
+            PublishSelectionEvents(_sequence);
+        }
+    }
+}
@@ -0,0 +1,414 @@
+#nullable enable
+
+using System;
+using System.Collections.Generic;
+using UnityEngine;
+
+namespace Vault
+{
+    /// <summary>
+    /// Picks a mesh per coin from its on-screen size and its depth in the pile: the prefab mesh up
+    /// close, a reduced cylinder further out, and a six-sided prism impostor for distant or deep
+    /// coins.
+    /// Coins that are settled and fully enclosed by the pile stop rendering (their colliders stay).
+    /// Owned and driven by <see cref="CoinSpawner"/>.
+    /// </summary>
+    /// <remarks>
+    /// Pile depth comes from the settled layout: coins are binned into coin-sized cells on the
+    /// ground plane and ranked by height within each cell. Depth only hides a coin when the
+    /// neighbouring columns also rise above it, so the sides of edge stacks stay visible.
+    /// </remarks>
+    public sealed class CoinLod : IDisposable
+    {
+        public const int Full = 0;
+        public const int Reduced = 1;
+        public const int Impostor = 2;
+        public const int Hidden = 3;
+
+        private const int ReducedSegments = 10;
+        // Closed like the other levels, so face-down and edge-on coins still show.
+        private const int ImpostorSegments = 6;
+        private const float MinBudgetBias = 0.25f;
+
+        private struct Entry
+        {
+            public Transform Transform;
+            public MeshFilter Filter;
+            public Rigidbody? Body;
+            public int Level;
+            public int PileLevel;
+        }
+
+        private readonly List<Entry> _coins = new();
+        private readonly Mesh[] _meshes = new Mesh[3];
+        private readonly int[] _triangles = new int[3];
+        private readonly int[] _levelCounts = new int[4];
+        private readonly Dictionary<int, float> _columnTops = new();
+        private readonly List<Renderer> _rendererBuffer = new();
+        private readonly float _reducedScreenHeight;
+        private readonly float _impostorScreenHeight;
+        private readonly int _impostorDepth;
+        private readonly int _buriedDepth;
+        private readonly int _triangleBudget;
+        private readonly float _diameter;
+        private readonly float _thickness;
+
+        private long[] _pileKeys = Array.Empty<long>();
+        private int[] _pileIndices = Array.Empty<int>();
+        private float _budgetBias = 1f;
+
+        /// <param name="prefabMesh">Mesh of the coin prefab, used at full detail.</param>
+        /// <param name="prefabScale">Scale of the coin prefab, to size the pile cells.</param>
+        /// <param name="reducedScreenHeight">Screen-height fraction below which coins use the reduced mesh.</param>
+        /// <param name="impostorScreenHeight">Screen-height fraction below which coins use the impostor.</param>
+        /// <param name="impostorDepth">Pile depth at which enclosed coins use the impostor.</param>
+        /// <param name="buriedDepth">Pile depth at which enclosed coins stop rendering.</param>
+        /// <param name="triangleBudget">Coin triangles per frame; LOD distances shrink while over it.</param>
+        public CoinLod(
+            Mesh prefabMesh,
+            Vector3 prefabScale,
+            float reducedScreenHeight,
+            float impostorScreenHeight,
+            int impostorDepth,
+            int buriedDepth,
+            int triangleBudget)
+        {
+            var bounds = prefabMesh.bounds;
+            _diameter = Mathf.Max(bounds.size.x * prefabScale.x, bounds.size.z * prefabScale.z);
+            _thickness = bounds.size.y * prefabScale.y;
+            _reducedScreenHeight = reducedScreenHeight;
+            _impostorScreenHeight = Mathf.Min(impostorScreenHeight, reducedScreenHeight);
+            _impostorDepth = Mathf.Max(1, impostorDepth);
+            _buriedDepth = Mathf.Max(_impostorDepth, buriedDepth);
+            _triangleBudget = triangleBudget;
+
+            _meshes[Full] = prefabMesh;
+            _meshes[Reduced] = BuildCylinder(bounds, ReducedSegments, $"CoinLod{ReducedSegments}");
+            _meshes[Impostor] = BuildCylinder(bounds, ImpostorSegments, "CoinImpostor");
+            for (var i = 0; i < _meshes.Length; i++)
+            {
+                _triangles[i] = TriangleCount(_meshes[i]);
+            }
+        }
+
+        /// <summary>
+        /// Triangles submitted for coins in the last update.
+        /// </summary>
+        public int Triangles { get; private set; }
+
+        /// <summary>
+        /// Coins not rendered because they are buried in the pile.
+        /// </summary>
+        public int HiddenCount => _levelCounts[Hidden];
+
+        /// <summary>
+        /// Number of coins at <paramref name="level"/> (<see cref="Full"/> to <see cref="Hidden"/>) after the last update.
+        /// </summary>
+        public int CountAt(int level) => _levelCounts[level];
+
+        public void Add(GameObject coin)
+        {
+            var filter = coin.GetComponentInChildren<MeshFilter>();
+            if (filter == null)
+            {
+                return;
+            }
+
+            _coins.Add(new Entry
+            {
+                Transform = coin.transform,
+                Filter = filter,
+                Body = coin.GetComponent<Rigidbody>(),
+                Level = Full,
+                PileLevel = Full,
+            });
+        }
+
+        /// <summary>
+        /// Forgets <paramref name="coins"/>; called before they are destroyed.
+        /// </summary>
+        public void Remove(ISet<GameObject> coins)
+        {
+            _coins.RemoveAll(entry => entry.Transform == null || coins.Contains(entry.Transform.gameObject));
+        }
+
+        public void Clear()
+        {
+            _coins.Clear();
+            Array.Clear(_levelCounts, 0, _levelCounts.Length);
+            Triangles = 0;
+            _budgetBias = 1f;
+        }
+
+        /// <summary>
+        /// Chooses the level of every coin for <paramref name="camera"/> and applies changes.
+        /// </summary>
+        public void Update(Camera camera)
+        {
+            // Distance at which a coin covers a given fraction of the screen height.
+            var viewHeightPerUnit = 2f * Mathf.Tan(camera.fieldOfView * 0.5f * Mathf.Deg2Rad);
+            var reducedDistance = _diameter / (_reducedScreenHeight * viewHeightPerUnit) * _budgetBias;
+            var impostorDistance = _diameter / (_impostorScreenHeight * viewHeightPerUnit) * _budgetBias;
+            var reducedSqr = reducedDistance * reducedDistance;
+            var impostorSqr = impostorDistance * impostorDistance;
+            var eye = camera.transform.position;
+
+            Array.Clear(_levelCounts, 0, _levelCounts.Length);
+            var triangles = 0;
+            for (var i = 0; i < _coins.Count; i++)
+            {
+                var entry = _coins[i];
+                if (entry.Transform == null)
+                {
+                    continue;
+                }
+
+                var sqr = (entry.Transform.position - eye).sqrMagnitude;
+                var level = sqr > impostorSqr ? Impostor : sqr > reducedSqr ? Reduced : Full;
+                level = Mathf.Max(level, entry.PileLevel);
+                if (level != entry.Level)
+                {
+                    Apply(entry, level);
+                    entry.Level = level;
+                    _coins[i] = entry;
+                }
+
+                _levelCounts[level]++;
+                if (level != Hidden)
+                {
+                    triangles += _triangles[level];
+                }
+            }
+
+            Triangles = triangles;
+            if (_triangleBudget > 0 && triangles > _triangleBudget)
+            {
+                _budgetBias = Mathf.Max(MinBudgetBias, _budgetBias * 0.9f);
+            }
+            else if (triangles < _triangleBudget * 0.8f)
+            {
+                _budgetBias = Mathf.Min(1f, _budgetBias * 1.05f);
+            }
+        }
+
+        /// <summary>
+        /// Recomputes pile depth for settled coins. Moving coins are never treated as buried.
+        /// </summary>
+        public void UpdatePile()
+        {
+            var count = _coins.Count;
+            if (_pileKeys.Length < count)
+            {
+                _pileKeys = new long[Mathf.NextPowerOfTwo(count)];
+                _pileIndices = new int[_pileKeys.Length];
+            }
+
+            _columnTops.Clear();
+            var settled = 0;
+            for (var i = 0; i < count; i++)
+            {
+                var entry = _coins[i];
+                if (entry.Transform == null)
+                {
+                    continue;
+                }
+
+                var position = entry.Transform.position;
+                var cell = CellOf(position);
+                if (!_columnTops.TryGetValue(cell, out var top) || position.y > top)
+                {
+                    _columnTops[cell] = position.y;
+                }
+
+                if (entry.Body != null && !entry.Body.IsSleeping())
+                {
+                    if (entry.PileLevel != Full)
+                    {
+                        entry.PileLevel = Full;
+                        _coins[i] = entry;
+                    }
+                    continue;
+                }
+
+                // Group by cell, highest coin first within a cell.
+                var height = Mathf.Clamp(Mathf.RoundToInt(position.y * 1000f), -int.MaxValue / 2, int.MaxValue / 2);
+                _pileKeys[settled] = ((long)(uint)cell << 32) | (uint)(int.MaxValue / 2 - height);
+                _pileIndices[settled] = i;
+                settled++;
+            }
+
+            Array.Sort(_pileKeys, _pileIndices, 0, settled);
+
+            var depth = 0;
+            var previousCell = 0L;
+            for (var k = 0; k < settled; k++)
+            {
+                var cell = _pileKeys[k] >> 32;
+                depth = k > 0 && cell == previousCell ? depth + 1 : 0;
+                previousCell = cell;
+
+                var index = _pileIndices[k];
+                var entry = _coins[index];
+                var level = Full;
+                if (depth >= _impostorDepth)
+                {
+                    var position = entry.Transform.position;
+                    if (Enclosed(position, position.y + _thickness) && depth >= _buriedDepth)
+                    {
+                        level = Hidden;
+                    }
+                    else if (Enclosed(position, position.y))
+                    {
+                        level = Impostor;
+                    }
+                }
+
+                if (entry.PileLevel != level)
+                {
+                    entry.PileLevel = level;
+                    _coins[index] = entry;
+                }
+            }
+        }
+
+        public void Dispose()
+        {
+            for (var i = Reduced; i < _meshes.Length; i++)
+            {
+                if (_meshes[i] != null)
+                {
+                    UnityEngine.Object.Destroy(_meshes[i]);
+                }
+            }
+        }
+
+        private void Apply(Entry entry, int level)
+        {
+            var wasHidden = entry.Level == Hidden;
+            if (level != Hidden)
+            {
+                entry.Filter.sharedMesh = _meshes[level];
+            }
+
+            if (wasHidden != (level == Hidden))
+            {
+                // Includes the fallback label, which is added after the coin is registered.
+                entry.Transform.GetComponentsInChildren(true, _rendererBuffer);
+                for (var i = 0; i < _rendererBuffer.Count; i++)
+                {
+                    _rendererBuffer[i].enabled = level != Hidden;
+                }
+                _rendererBuffer.Clear();
+            }
+        }
+
+        /// <summary>
+        /// True when all four neighbouring columns reach <paramref name="height"/>.
+        /// </summary>
+        private bool Enclosed(Vector3 position, float height)
+        {
+            return ColumnReaches(position + new Vector3(_diameter, 0f, 0f), height) &&
+                   ColumnReaches(position - new Vector3(_diameter, 0f, 0f), height) &&
+                   ColumnReaches(position + new Vector3(0f, 0f, _diameter), height) &&
+                   ColumnReaches(position - new Vector3(0f, 0f, _diameter), height);
+        }
+
+        private bool ColumnReaches(Vector3 position, float height)
+        {
+            return _columnTops.TryGetValue(CellOf(position), out var top) && top >= height;
+        }
+
+        private int CellOf(Vector3 position)
+        {
+            var x = Mathf.FloorToInt(position.x / _diameter);
+            var z = Mathf.FloorToInt(position.z / _diameter);
+            return ((x & 0xFFFF) << 16) | (z & 0xFFFF);
+        }
+
+        private static int TriangleCount(Mesh mesh)
+        {
+            var indices = 0L;
+            for (var i = 0; i < mesh.subMeshCount; i++)
+            {
+                indices += mesh.GetIndexCount(i);
+            }
+
+            return (int)(indices / 3);
+        }
+
+        /// <summary>
+        /// Cylinder filling <paramref name="bounds"/> with cap UVs matching Unity's built-in cylinder,
+        /// so token materials map the same way.
+        /// </summary>
+        private static Mesh BuildCylinder(Bounds bounds, int segments, string name)
+        {
+            var radius = new Vector2(bounds.extents.x, bounds.extents.z);
+            var center = bounds.center;
+            var top = bounds.max.y;
+            var bottom = bounds.min.y;
+
+            var vertices = new List<Vector3>();
+            var normals = new List<Vector3>();
+            var uvs = new List<Vector2>();
+            var indices = new List<int>();
+
+            void AddCap(float y, bool up)
+            {
+                var start = vertices.Count;
+                for (var i = 0; i < segments; i++)
+                {
+                    var angle = i * Mathf.PI * 2f / segments;
+                    var x = Mathf.Cos(angle);
+                    var z = Mathf.Sin(angle);
+                    vertices.Add(new Vector3(center.x + x * radius.x, y, center.z + z * radius.y));
+                    normals.Add(up ? Vector3.up : Vector3.down);
+                    uvs.Add(new Vector2(0.5f + x * 0.5f, 0.5f + z * 0.5f));
+                }
+
+                for (var i = 1; i < segments - 1; i++)
+                {
+                    indices.Add(start);
+                    indices.Add(up ? start + i + 1 : start + i);
+                    indices.Add(up ? start + i : start + i + 1);
+                }
+            }
+
+            AddCap(top, true);
+            AddCap(bottom, false);
+            var start = vertices.Count;
+            for (var i = 0; i <= segments; i++)
+            {
+                var angle = i * Mathf.PI * 2f / segments;
+                var normal = new Vector3(Mathf.Cos(angle), 0f, Mathf.Sin(angle));
+                var rim = new Vector3(center.x + normal.x * radius.x, 0f, center.z + normal.z * radius.y);
+                var u = (float)i / segments;
+                vertices.Add(new Vector3(rim.x, top, rim.z));
+                vertices.Add(new Vector3(rim.x, bottom, rim.z));
+                normals.Add(normal);
+                normals.Add(normal);
+                uvs.Add(new Vector2(u, 1f));
+                uvs.Add(new Vector2(u, 0f));
+            }
+
+            for (var i = 0; i < segments; i++)
+            {
+                var a = start + i * 2;
+                indices.Add(a);
+                indices.Add(a + 2);
+                indices.Add(a + 1);
+                indices.Add(a + 1);
+                indices.Add(a + 2);
+                indices.Add(a + 3);
+            }
+
+            var mesh = new Mesh { name = name };
+            mesh.SetVertices(vertices);
+            mesh.SetNormals(normals);
+            mesh.SetUVs(0, uvs);
+            mesh.SetTriangles(indices, 0);
+            mesh.bounds = bounds;
+            mesh.UploadMeshData(true);
+            return mesh;
+        }
+    }
+}
@@ -10,16 +10,12 @@ namespace Vault
 {
     /// <summary>
     /// Responsible for instantiating coin prefabs, applying token materials, and adding physics impulse.
+    /// Token logos stream in through <see cref="TokenTextureCache"/>; coins show their fallback label
+    /// until the logo arrives and again if it is evicted. Coin detail follows camera distance and
+    /// pile depth through <see cref="CoinLod"/>.
     /// </summary>
     public class CoinSpawner : MonoBehaviour
     {
-        [Serializable]
-        private struct TokenTexture
-        {
-            public string symbol;
-            public Texture2D texture;
-        }
-
         [SerializeField] private GameObject coinPrefab = default!;
         [SerializeField] private BoxCollider? spawnVolume = default;
         [SerializeField] private Material? coinMaterialTemplate = default;
@@ -28,32 +24,95 @@ namespace Vault
         [SerializeField] private float spawnSpread = 0.5f;
         [SerializeField] private float spawnImpulse = 1.5f;
         [SerializeField] private float torqueImpulse = 0.75f;
-        [SerializeField] private List<TokenTexture> tokenTextures = new();
+        [SerializeField] private string tokenTextureFolder = "Tokens";
+        [SerializeField] private int maxResidentTextures = 64;
+        [SerializeField] private int maxConcurrentTextureLoads = 4;
+        [SerializeField] private float reducedLodScreenHeight = 0.02f;
+        [SerializeField] private float impostorScreenHeight = 0.008f;
+        [SerializeField] private int impostorPileDepth = 2;
+        [SerializeField] private int buriedPileDepth = 4;
+        [SerializeField] private int coinTriangleBudget = 150000;
+        [SerializeField] private float pileUpdateInterval = 0.5f;
 
         private readonly Dictionary<string, Material> _materialCache = new(StringComparer.OrdinalIgnoreCase);
+        private readonly Dictionary<string, List<GameObject>> _coinsBySymbol = new(StringComparer.OrdinalIgnoreCase);
         private readonly List<GameObject> _spawnedCoins = new();
+        private readonly List<List<GameObject>> _coinsByBalance = new();
+        private readonly HashSet<GameObject> _removing = new();
+        private TokenTextureCache? _textures;
+        private Material? _prefabMaterial;
+        private CoinLod? _lod;
+        private Camera? _camera;
+        private float _nextPileUpdateAt;
+
+        /// <summary>
+        /// Number of coins currently spawned by this spawner.
+        /// </summary>
+        public int ActiveCoinCount => _spawnedCoins.Count;
+
+        /// <summary>
+        /// Logo cache backing the coin materials; null until Awake.
+        /// </summary>
+        public TokenTextureCache? Textures => _textures;
+
+        /// <summary>
+        /// Coin level-of-detail state; null until Awake or when the prefab has no mesh.
+        /// </summary>
+        public CoinLod? Lod => _lod;
 
         private static readonly int BaseMapId = Shader.PropertyToID("_BaseMap");
         private static readonly int MainTexId = Shader.PropertyToID("_MainTex");
 
         private void Awake()
         {
-            BuildMaterialCache();
+            var prefabRenderer = coinPrefab != null ? coinPrefab.GetComponentInChildren<MeshRenderer>() : null;
+            _prefabMaterial = prefabRenderer != null ? prefabRenderer.sharedMaterial : null;
+            _textures = new TokenTextureCache(tokenTextureFolder, maxResidentTextures, maxConcurrentTextureLoads);
+            _textures.Loaded += HandleTextureLoaded;
+            _textures.Evicted += HandleTextureEvicted;
+
+            var prefabFilter = coinPrefab != null ? coinPrefab.GetComponentInChildren<MeshFilter>() : null;
+            if (prefabFilter != null && prefabFilter.sharedMesh != null)
+            {
+                _lod = new CoinLod(
+                    prefabFilter.sharedMesh,
+                    prefabFilter.transform.lossyScale,
+                    reducedLodScreenHeight,
+                    impostorScreenHeight,
+                    impostorPileDepth,
+                    buriedPileDepth,
+                    coinTriangleBudget);
+            }
         }
 
-        private void OnValidate()
+        private void LateUpdate()
         {
-            if (Application.isPlaying)
+            if (_lod == null || _spawnedCoins.Count == 0)
             {
                 return;
             }
 
-            _materialCache.Clear();
-            BuildMaterialCache();
+            if (Time.time >= _nextPileUpdateAt)
+            {
+                _nextPileUpdateAt = Time.time + pileUpdateInterval;
+                _lod.UpdatePile();
+            }
+
+            if (_camera == null || !_camera.isActiveAndEnabled)
+            {
+                _camera = Camera.main;
+            }
+
+            if (_camera != null)
+            {
+                _lod.Update(_camera);
+            }
         }
 
         private void OnDestroy()
         {
+            _textures?.Dispose();
+            _lod?.Dispose();
             foreach (var material in _materialCache.Values)
             {
                 if (material != null)
@@ -79,14 +138,70 @@ namespace Vault
             }
 
             _spawnedCoins.Clear();
+            _lod?.Clear();
+            foreach (var coins in _coinsBySymbol.Values)
+            {
+                coins.Clear();
+            }
+
+            foreach (var coins in _coinsByBalance)
+            {
+                coins.Clear();
+            }
+        }
+
+        /// <summary>
+        /// Clears the coins spawned for one balance, leaving the rest of the pile in place.
+        /// </summary>
+        /// <param name="symbolId">Index of the balance in the wallet payload.</param>
+        public void ClearBalance(int symbolId)
+        {
+            if (symbolId < 0 || symbolId >= _coinsByBalance.Count || _coinsByBalance[symbolId].Count == 0)
+            {
+                return;
+            }
+
+            var coins = _coinsByBalance[symbolId];
+            _removing.Clear();
+            _removing.UnionWith(coins);
+            _spawnedCoins.RemoveAll(_removing.Contains);
+            foreach (var symbolCoins in _coinsBySymbol.Values)
+            {
+                symbolCoins.RemoveAll(_removing.Contains);
+            }
+            _lod?.Remove(_removing);
+
+            for (var i = 0; i < coins.Count; i++)
+            {
+                if (coins[i] != null)
+                {
+                    Destroy(coins[i]);
+                }
+            }
+
+            coins.Clear();
+            _removing.Clear();
+        }
+
+        /// <summary>
+        /// Registers the logo URL from the wallet payload for a symbol without a bundled texture.
+        /// </summary>
+        /// <param name="symbol">Token symbol.</param>
+        /// <param name="logoUrl">Logo URL; ignored when empty.</param>
+        /// <param name="logoHash">Optional content hash of the logo, used as its cache key.</param>
+        public void SetLogoSource(string symbol, string? logoUrl, string? logoHash)
+        {
+            _textures?.SetRemoteSource(symbol, logoUrl, logoHash);
         }
 
         /// <summary>
         /// Spawns a stack of coins for the provided token symbol.
         /// </summary>
         /// <param name="symbol">Token symbol.</param>
+        /// <param name="symbolId">Index of the balance in the wallet payload.</param>
+        /// <param name="tier">Aggregation tier of the batch (power of ten per coin).</param>
         /// <param name="countsPerCoin">Per-coin aggregated counts.</param>
-        public void Spawn(string symbol, IReadOnlyList<int> countsPerCoin)
+        public void Spawn(string symbol, int symbolId, int tier, IReadOnlyList<int> countsPerCoin)
         {
             if (coinPrefab == null)
             {
@@ -107,13 +222,16 @@ namespace Vault
 
                 var coin = Instantiate(coinPrefab, position, rotation, transform);
                 _spawnedCoins.Add(coin);
+                CoinsFor(symbol).Add(coin);
+                CoinsFor(symbolId).Add(coin);
+                _lod?.Add(coin);
 
-                ConfigureCoin(coin, symbol, count);
+                ConfigureCoin(coin, symbol, count, symbolId, tier, i);
                 ApplyImpulse(coin);
             }
         }
 
-        private void ConfigureCoin(GameObject coin, string symbol, int count)
+        private void ConfigureCoin(GameObject coin, string symbol, int count, int symbolId, int tier, int coinIndex)
         {
             var uppercase = string.IsNullOrWhiteSpace(symbol) ? "UNKNOWN" : symbol.ToUpperInvariant();
             var material = ResolveMaterial(uppercase);
@@ -138,7 +256,7 @@ namespace Vault
                 selectable = coin.AddComponent<CoinSelectable>();
             }
 
-            selectable.Configure(uppercase, Mathf.Max(0, count));
+            selectable.Configure(uppercase, Mathf.Max(0, count), symbolId, tier, coinIndex);
         }
 
         private void ApplyImpulse(GameObject coin)
@@ -188,34 +306,107 @@ namespace Vault
                 UnityEngine.Random.Range(-10f, 10f));
         }
 
-        private void BuildMaterialCache()
+        private List<GameObject> CoinsFor(string symbol)
+        {
+            if (!_coinsBySymbol.TryGetValue(symbol, out var coins))
+            {
+                coins = new List<GameObject>();
+                _coinsBySymbol[symbol] = coins;
+            }
+
+            return coins;
+        }
+
+        private List<GameObject> CoinsFor(int symbolId)
+        {
+            while (_coinsByBalance.Count <= symbolId)
+            {
+                _coinsByBalance.Add(new List<GameObject>());
+            }
+
+            return _coinsByBalance[symbolId];
+        }
+
+        private Material? ResolveMaterial(string symbol)
+        {
+            if (_textures == null)
+            {
+                return null;
+            }
+
+            if (!_textures.TryGet(symbol, out var texture))
+            {
+                _textures.Request(symbol);
+                return null;
+            }
+
+            if (!_materialCache.TryGetValue(symbol, out var material) || material == null)
+            {
+                material = CreateMaterialInstance(texture, symbol);
+                _materialCache[symbol] = material;
+            }
+
+            return material;
+        }
+
+        private void HandleTextureLoaded(string symbol, Texture2D texture)
         {
-            for (int i = 0; i < tokenTextures.Count; i++)
+            if (!_coinsBySymbol.TryGetValue(symbol, out var coins) || coins.Count == 0)
+            {
+                return;
+            }
+
+            var material = ResolveMaterial(symbol);
+            for (var i = 0; i < coins.Count; i++)
             {
-                var entry = tokenTextures[i];
-                if (entry.texture == null)
+                var coin = coins[i];
+                if (coin == null)
                 {
                     continue;
                 }
 
-                var key = (entry.symbol ?? string.Empty).ToUpperInvariant();
-                if (string.IsNullOrEmpty(key))
+                var renderer = coin.GetComponentInChildren<MeshRenderer>();
+                if (renderer != null)
                 {
-                    continue;
+                    renderer.sharedMaterial = material;
                 }
 
-                _materialCache[key] = CreateMaterialInstance(entry.texture, key);
+                ApplyFallbackLabel(coin, symbol, false);
             }
         }
 
-        private Material? ResolveMaterial(string symbol)
+        private void HandleTextureEvicted(string symbol)
         {
-            if (_materialCache.TryGetValue(symbol, out var cached) && cached != null)
+            if (_materialCache.TryGetValue(symbol, out var material))
+            {
+                _materialCache.Remove(symbol);
+                if (material != null)
+                {
+                    Destroy(material);
+                }
+            }
+
+            if (!_coinsBySymbol.TryGetValue(symbol, out var coins))
             {
-                return cached;
+                return;
             }
 
-            return null;
+            for (var i = 0; i < coins.Count; i++)
+            {
+                var coin = coins[i];
+                if (coin == null)
+                {
+                    continue;
+                }
+
+                var renderer = coin.GetComponentInChildren<MeshRenderer>();
+                if (renderer != null)
+                {
+                    renderer.sharedMaterial = _prefabMaterial;
+                }
+
+                ApplyFallbackLabel(coin, symbol, true);
+            }
         }
 
         private Material CreateMaterialInstance(Texture2D texture, string symbol)
@@ -225,6 +416,7 @@ namespace Vault
                 : new Material(Shader.Find("Standard"));
 
             template.name = $"M_{symbol}";
+            template.enableInstancing = true;
             if (texture != null)
             {
                 if (template.HasProperty(BaseMapId))
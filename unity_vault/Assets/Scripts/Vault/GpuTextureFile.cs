@@ -0,0 +1,88 @@
+#nullable enable
+
+using System;
+using System.Runtime.InteropServices;
+using UnityEngine;
+
+namespace Vault
+{
+    /// <summary>
+    /// File format for token logos compressed at build time (<c>BuildTools.TokenTextureIndex</c>):
+    /// a 20-byte header (magic, width, height, mip count, <see cref="TextureFormat"/>) followed by the
+    /// raw GPU data of every mip, so loading is a single upload with no decode.
+    /// </summary>
+    public static class GpuTextureFile
+    {
+        public const string Extension = ".tex";
+
+        private const int Magic = 0x31585456; // "VTX1"
+        private const int HeaderSize = 20;
+
+        /// <summary>
+        /// Formats written per logo, in the order the runtime prefers them, with their file suffix.
+        /// </summary>
+        public static readonly (string Suffix, TextureFormat Format)[] Formats =
+        {
+            ("astc", TextureFormat.ASTC_6x6),
+            ("etc2", TextureFormat.ETC2_RGBA8),
+            ("dxt", TextureFormat.DXT5),
+        };
+
+        public static byte[] Write(Texture2D texture)
+        {
+            var data = texture.GetRawTextureData();
+            var bytes = new byte[HeaderSize + data.Length];
+            WriteInt(bytes, 0, Magic);
+            WriteInt(bytes, 4, texture.width);
+            WriteInt(bytes, 8, texture.height);
+            WriteInt(bytes, 12, texture.mipmapCount);
+            WriteInt(bytes, 16, (int)texture.format);
+            Buffer.BlockCopy(data, 0, bytes, HeaderSize, data.Length);
+            return bytes;
+        }
+
+        /// <summary>
+        /// Uploads the file as a non-readable texture, or returns null when it is not a valid file.
+        /// </summary>
+        public static Texture2D? Read(byte[] bytes)
+        {
+            if (bytes.Length <= HeaderSize || BitConverter.ToInt32(bytes, 0) != Magic)
+            {
+                return null;
+            }
+
+            var width = BitConverter.ToInt32(bytes, 4);
+            var height = BitConverter.ToInt32(bytes, 8);
+            var mipCount = BitConverter.ToInt32(bytes, 12);
+            var format = (TextureFormat)BitConverter.ToInt32(bytes, 16);
+            var texture = new Texture2D(width, height, format, mipCount, false);
+
+            var handle = GCHandle.Alloc(bytes, GCHandleType.Pinned);
+            try
+            {
+                texture.LoadRawTextureData(handle.AddrOfPinnedObject() + HeaderSize, bytes.Length - HeaderSize);
+            }
+            catch (UnityException)
+            {
+                // Data size does not match the header.
+                UnityEngine.Object.Destroy(texture);
+                return null;
+            }
+            finally
+            {
+                handle.Free();
+            }
+
+            texture.Apply(false, true);
+            return texture;
+        }
+
+        private static void WriteInt(byte[] bytes, int offset, int value)
+        {
+            bytes[offset] = (byte)value;
+            bytes[offset + 1] = (byte)(value >> 8);
+            bytes[offset + 2] = (byte)(value >> 16);
+            bytes[offset + 3] = (byte)(value >> 24);
+        }
+    }
+}
@@ -0,0 +1,461 @@
+#nullable enable
+
+using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.IO;
+using UnityEngine;
+using UnityEngine.Networking;
+using Debug = UnityEngine.Debug;
+
+namespace Vault
+{
+    /// <summary>
+    /// Streams token logos on first use and keeps at most <c>capacity</c> of them resident, evicting
+    /// the least recently used. Bundled logos come from <c>StreamingAssets/&lt;folder&gt;/&lt;SYMBOL&gt;.png</c>;
+    /// other symbols fall back to the logo URL carried in the wallet payload.
+    /// </summary>
+    /// <remarks>
+    /// Only symbols listed in <c>&lt;folder&gt;/index.json</c> (written by
+    /// <c>BuildTools.TokenTextureIndex</c>) or registered through <see cref="SetRemoteSource"/> are
+    /// requested, at most <c>maxConcurrentLoads</c> at a time. Bundled logos are loaded in the first
+    /// GPU format from <see cref="GpuTextureFile.Formats"/> that the build ships and the device
+    /// supports, falling back to the PNG, also when that GPU file is missing or unreadable. Remote logos are kept on disk under their content hash (or
+    /// a hash of the URL), so a logo is downloaded once per device; on WebGL the persistent data path
+    /// is IndexedDB. They are block-compressed after decoding where the device supports DXT.
+    /// </remarks>
+    public sealed class TokenTextureCache : IDisposable
+    {
+        [Serializable]
+        private class Index
+        {
+            public string[] symbols = Array.Empty<string>();
+            public string[] formats = Array.Empty<string>();
+        }
+
+        private enum LoadKind
+        {
+            BundledPng,
+            BundledGpu,
+            Remote,
+        }
+
+        private readonly struct Entry
+        {
+            public Entry(string symbol, Texture2D texture)
+            {
+                Symbol = symbol;
+                Texture = texture;
+                Bytes = EstimateBytes(texture);
+            }
+
+            public string Symbol { get; }
+            public Texture2D Texture { get; }
+            public long Bytes { get; }
+        }
+
+        private readonly struct RemoteSource
+        {
+            public RemoteSource(string url, string key)
+            {
+                Url = url;
+                Key = key;
+            }
+
+            public string Url { get; }
+            public string Key { get; }
+        }
+
+        private const int MaxLogoBytes = 512 * 1024;
+
+        private readonly string _root;
+        private readonly int _capacity;
+        private readonly int _maxConcurrentLoads;
+        private readonly string _diskCacheDirectory;
+        private readonly LinkedList<Entry> _recency = new();
+        private readonly Dictionary<string, LinkedListNode<Entry>> _resident = new(StringComparer.OrdinalIgnoreCase);
+        private readonly Dictionary<string, RemoteSource> _remoteSources = new(StringComparer.OrdinalIgnoreCase);
+        private readonly HashSet<string> _pending = new(StringComparer.OrdinalIgnoreCase);
+        private readonly HashSet<string> _failed = new(StringComparer.OrdinalIgnoreCase);
+        private readonly Queue<string> _queued = new();
+        private readonly List<UnityWebRequest> _inFlight = new();
+        private HashSet<string>? _available;
+        private string? _gpuSuffix;
+        private bool _disposed;
+        private int _decodeCount;
+        private float _decodeMilliseconds;
+        private float _maxDecodeMilliseconds;
+
+        /// <summary>
+        /// Raised when a requested texture has been decoded and is resident.
+        /// </summary>
+        public event Action<string, Texture2D>? Loaded;
+
+        /// <summary>
+        /// Raised right before an evicted texture is destroyed.
+        /// </summary>
+        public event Action<string>? Evicted;
+
+        public TokenTextureCache(string folder, int capacity, int maxConcurrentLoads = 4, string? diskCacheDirectory = null)
+        {
+            var root = $"{Application.streamingAssetsPath}/{folder}";
+            _root = root.Contains("://") ? root : "file://" + root;
+            _capacity = Mathf.Max(1, capacity);
+            _maxConcurrentLoads = Mathf.Max(1, maxConcurrentLoads);
+            _diskCacheDirectory = diskCacheDirectory ?? Path.Combine(Application.persistentDataPath, "TokenLogos");
+            LoadIndex();
+        }
+
+        public int ResidentCount => _resident.Count;
+
+        /// <summary>
+        /// Logos queued or loading.
+        /// </summary>
+        public int PendingCount => _pending.Count;
+
+        /// <summary>
+        /// Estimated GPU memory of the resident logos, mips included.
+        /// </summary>
+        public long ResidentBytes { get; private set; }
+
+        /// <summary>
+        /// File suffix of the GPU format bundled logos load in, or "png".
+        /// </summary>
+        public string BundledFormat => _gpuSuffix ?? "png";
+
+        /// <summary>
+        /// Returns decode/upload timings since the previous call and resets them.
+        /// </summary>
+        public void TakeDecodeStats(out int count, out float totalMilliseconds, out float maxMilliseconds)
+        {
+            count = _decodeCount;
+            totalMilliseconds = _decodeMilliseconds;
+            maxMilliseconds = _maxDecodeMilliseconds;
+            _decodeCount = 0;
+            _decodeMilliseconds = 0f;
+            _maxDecodeMilliseconds = 0f;
+        }
+
+        /// <summary>
+        /// Returns the resident texture for <paramref name="symbol"/> and marks it as recently used.
+        /// </summary>
+        public bool TryGet(string symbol, out Texture2D texture)
+        {
+            if (_resident.TryGetValue(symbol, out var node))
+            {
+                _recency.Remove(node);
+                _recency.AddFirst(node);
+                texture = node.Value.Texture;
+                return true;
+            }
+
+            texture = null!;
+            return false;
+        }
+
+        /// <summary>
+        /// Registers where to fetch the logo of a symbol that has no bundled texture.
+        /// </summary>
+        /// <param name="symbol">Token symbol.</param>
+        /// <param name="url">Logo URL from the wallet payload; ignored when empty.</param>
+        /// <param name="contentHash">Optional content hash; used as the disk cache key when set.</param>
+        public void SetRemoteSource(string symbol, string? url, string? contentHash)
+        {
+            if (string.IsNullOrEmpty(url))
+            {
+                return;
+            }
+
+            var key = string.IsNullOrEmpty(contentHash)
+                ? Hash128.Compute(url!).ToString()
+                : string.Concat(contentHash.Split(Path.GetInvalidFileNameChars()));
+            if (_remoteSources.TryGetValue(symbol, out var previous) && previous.Key == key)
+            {
+                return;
+            }
+
+            _remoteSources[symbol] = new RemoteSource(url!, key);
+            _failed.Remove(symbol);
+        }
+
+        /// <summary>
+        /// Queues the logo for <paramref name="symbol"/> unless it is resident, already queued, or
+        /// failed to load from its current source. <see cref="Loaded"/> fires when it arrives.
+        /// </summary>
+        public void Request(string symbol)
+        {
+            if (_disposed || _resident.ContainsKey(symbol) || _failed.Contains(symbol) || !_pending.Add(symbol))
+            {
+                return;
+            }
+
+            _queued.Enqueue(symbol);
+            Pump();
+        }
+
+        public void Dispose()
+        {
+            _disposed = true;
+            foreach (var request in _inFlight.ToArray())
+            {
+                request.Abort();
+            }
+
+            foreach (var entry in _recency)
+            {
+                UnityEngine.Object.Destroy(entry.Texture);
+            }
+
+            _recency.Clear();
+            _resident.Clear();
+            ResidentBytes = 0;
+            _queued.Clear();
+            _pending.Clear();
+        }
+
+        private void LoadIndex()
+        {
+            var request = UnityWebRequest.Get($"{_root}/index.json");
+            request.SendWebRequest().completed += _ =>
+            {
+                _available = new HashSet<string>(StringComparer.OrdinalIgnoreCase);
+                if (request.result == UnityWebRequest.Result.Success)
+                {
+                    var index = JsonUtility.FromJson<Index>(request.downloadHandler.text);
+                    _available.UnionWith(index?.symbols ?? Array.Empty<string>());
+                    _gpuSuffix = PickGpuFormat(index?.formats ?? Array.Empty<string>());
+                }
+                else
+                {
+                    Debug.LogWarning($"[TokenTextureCache] No token index at {request.url}: {request.error}");
+                }
+
+                request.Dispose();
+                Pump();
+            };
+        }
+
+        // Requests made before the index arrives stay queued until it does.
+        private void Pump()
+        {
+            while (!_disposed && _available != null && _queued.Count > 0 && _inFlight.Count < _maxConcurrentLoads)
+            {
+                Start(_queued.Dequeue());
+            }
+        }
+
+        private void Start(string symbol)
+        {
+            if (_available!.Contains(symbol))
+            {
+                if (_gpuSuffix != null)
+                {
+                    Send(symbol, UnityWebRequest.Get($"{_root}/gpu/{symbol}.{_gpuSuffix}{GpuTextureFile.Extension}"), LoadKind.BundledGpu);
+                }
+                else
+                {
+                    SendBundledPng(symbol);
+                }
+                return;
+            }
+
+            if (!_remoteSources.TryGetValue(symbol, out var source))
+            {
+                Finish(symbol, null);
+                return;
+            }
+
+            var cachedPath = Path.Combine(_diskCacheDirectory, source.Key);
+            if (File.Exists(cachedPath))
+            {
+                Finish(symbol, Decode(symbol, File.ReadAllBytes(cachedPath)));
+                return;
+            }
+
+            Send(symbol, UnityWebRequest.Get(source.Url), LoadKind.Remote, source.Key);
+        }
+
+        private static string? PickGpuFormat(string[] shipped)
+        {
+            foreach (var (suffix, format) in GpuTextureFile.Formats)
+            {
+                if (Array.IndexOf(shipped, suffix) >= 0 && SystemInfo.SupportsTextureFormat(format))
+                {
+                    return suffix;
+                }
+            }
+
+            return null;
+        }
+
+        // storeKey is the disk cache key of the source the request was sent for; the symbol's source
+        // may change while it is in flight.
+        private void Send(string symbol, UnityWebRequest request, LoadKind kind, string? storeKey = null)
+        {
+            _inFlight.Add(request);
+            request.SendWebRequest().completed += _ =>
+            {
+                _inFlight.Remove(request);
+                if (_disposed)
+                {
+                    request.Dispose();
+                    return;
+                }
+
+                Texture2D? texture = null;
+                if (request.result != UnityWebRequest.Result.Success)
+                {
+                    Debug.LogWarning($"[TokenTextureCache] Failed to load {symbol} from {request.url}: {request.error}");
+                }
+                else if (kind == LoadKind.BundledPng)
+                {
+                    var started = Stopwatch.GetTimestamp();
+                    texture = LoadPng(request.downloadHandler.data);
+                    RecordDecode(started);
+                }
+                else if (kind == LoadKind.BundledGpu)
+                {
+                    var started = Stopwatch.GetTimestamp();
+                    texture = GpuTextureFile.Read(request.downloadHandler.data);
+                    RecordDecode(started);
+                }
+                else
+                {
+                    var bytes = request.downloadHandler.data;
+                    texture = Decode(symbol, bytes);
+                    if (texture != null && storeKey != null)
+                    {
+                        Store(storeKey, bytes);
+                    }
+                }
+
+                request.Dispose();
+                if (texture == null && kind == LoadKind.BundledGpu)
+                {
+                    // gpu/ is generated before each build and may be missing or stale; the PNG ships
+                    // with every build.
+                    Debug.LogWarning($"[TokenTextureCache] No usable {_gpuSuffix} logo for {symbol}; loading the PNG.");
+                    SendBundledPng(symbol);
+                    return;
+                }
+
+                Finish(symbol, texture);
+                Pump();
+            };
+        }
+
+        private void SendBundledPng(string symbol)
+        {
+            Send(symbol, UnityWebRequest.Get($"{_root}/{symbol}.png"), LoadKind.BundledPng);
+        }
+
+        // Decodes and uploads in one timed step, like GpuTextureFile.Read, so the two formats'
+        // timings compare.
+        private static Texture2D? LoadPng(byte[]? bytes)
+        {
+            if (bytes == null || bytes.Length == 0)
+            {
+                return null;
+            }
+
+            var texture = new Texture2D(2, 2, TextureFormat.RGBA32, true);
+            if (texture.LoadImage(bytes, markNonReadable: true))
+            {
+                return texture;
+            }
+
+            UnityEngine.Object.Destroy(texture);
+            return null;
+        }
+
+        private Texture2D? Decode(string symbol, byte[]? bytes)
+        {
+            if (bytes == null || bytes.Length == 0 || bytes.Length > MaxLogoBytes)
+            {
+                Debug.LogWarning($"[TokenTextureCache] Ignoring logo for {symbol}: {bytes?.Length ?? 0} bytes.");
+                return null;
+            }
+
+            var started = Stopwatch.GetTimestamp();
+            var texture = new Texture2D(2, 2, TextureFormat.RGBA32, true);
+            if (texture.LoadImage(bytes, markNonReadable: false))
+            {
+                // DXT5 needs dimensions in whole 4x4 blocks; other logos stay RGBA32.
+                if (texture.width % 4 == 0 && texture.height % 4 == 0 && SystemInfo.SupportsTextureFormat(TextureFormat.DXT5))
+                {
+                    texture.Compress(false);
+                }
+
+                texture.Apply(false, true);
+                RecordDecode(started);
+                return texture;
+            }
+
+            UnityEngine.Object.Destroy(texture);
+            Debug.LogWarning($"[TokenTextureCache] Logo for {symbol} is not a PNG or JPEG.");
+            return null;
+        }
+
+        private void Store(string key, byte[] bytes)
+        {
+            try
+            {
+                Directory.CreateDirectory(_diskCacheDirectory);
+                File.WriteAllBytes(Path.Combine(_diskCacheDirectory, key), bytes);
+            }
+            catch (IOException ex)
+            {
+                Debug.LogWarning($"[TokenTextureCache] Could not cache logo {key}: {ex.Message}");
+            }
+        }
+
+        private void Finish(string symbol, Texture2D? texture)
+        {
+            _pending.Remove(symbol);
+            if (texture == null)
+            {
+                _failed.Add(symbol);
+                return;
+            }
+
+            texture.name = $"T_{symbol}";
+            var node = _recency.AddFirst(new Entry(symbol, texture));
+            _resident[symbol] = node;
+            ResidentBytes += node.Value.Bytes;
+            while (_resident.Count > _capacity)
+            {
+                var oldest = _recency.Last;
+                _recency.RemoveLast();
+                _resident.Remove(oldest.Value.Symbol);
+                ResidentBytes -= oldest.Value.Bytes;
+                Evicted?.Invoke(oldest.Value.Symbol);
+                UnityEngine.Object.Destroy(oldest.Value.Texture);
+            }
+
+            Loaded?.Invoke(symbol, texture);
+        }
+
+        private void RecordDecode(long started)
+        {
+            var milliseconds = (float)((Stopwatch.GetTimestamp() - started) * 1000d / Stopwatch.Frequency);
+            _decodeCount++;
+            _decodeMilliseconds += milliseconds;
+            _maxDecodeMilliseconds = Mathf.Max(_maxDecodeMilliseconds, milliseconds);
+        }
+
+        private static long EstimateBytes(Texture2D texture)
+        {
+            var bitsPerPixel = texture.format switch
+            {
+                TextureFormat.ASTC_6x6 => 3.56f,
+                TextureFormat.ETC2_RGBA8 => 8f,
+                TextureFormat.DXT5 => 8f,
+                TextureFormat.DXT1 => 4f,
+                TextureFormat.ETC2_RGB => 4f,
+                _ => 32f,
+            };
+            var mipFactor = texture.mipmapCount > 1 ? 4f / 3f : 1f;
+            return (long)(texture.width * texture.height * bitsPerPixel / 8f * mipFactor);
+        }
+    }
+}
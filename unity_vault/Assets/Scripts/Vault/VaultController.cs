@@ -1,5 +1,6 @@
 #nullable enable
 
+using System;
 using Messaging;
 using UnityEngine;
 using Wallet;
@@ -8,6 +9,8 @@ namespace Vault
 {
     /// <summary>
     /// Controls the vault door animation lifecycle and coordinates coin spawning.
+    /// Wallet updates are applied per balance: only balances that were added or changed since
+    /// the previous payload respawn, so a wallet that streams in asset by asset keeps its pile.
     /// </summary>
     public class VaultController : MonoBehaviour
     {
@@ -17,6 +20,8 @@ namespace Vault
         [SerializeField] private string closedStateName = "Closed";
 
         private bool _doorOpened;
+        private bool _firstCoinReported;
+        private WalletMessage.Balance[] _spawnedBalances = Array.Empty<WalletMessage.Balance>();
 
         private void OnEnable()
         {
@@ -40,6 +45,7 @@ namespace Vault
             if (message == null || message.balances == null || message.balances.Length == 0)
             {
                 coinSpawner?.ClearCoins();
+                _spawnedBalances = Array.Empty<WalletMessage.Balance>();
                 return;
             }
 
@@ -48,23 +54,55 @@ namespace Vault
                 TriggerDoorOpen();
             }
 
-            coinSpawner?.ClearCoins();
+            var previous = _spawnedBalances;
+            _spawnedBalances = message.balances;
+            for (var i = message.balances.Length; i < previous.Length; i++)
+            {
+                coinSpawner?.ClearBalance(i);
+            }
 
-            foreach (var balance in message.balances)
+            for (int i = 0; i < message.balances.Length; i++)
             {
+                var balance = message.balances[i];
+                if (i < previous.Length)
+                {
+                    if (SameCoins(previous[i], balance))
+                    {
+                        continue;
+                    }
+
+                    coinSpawner?.ClearBalance(i);
+                }
+
                 var batch = CoinAggregator.Compute(balance.symbol, balance.amount);
                 if (batch.coinCount <= 0)
                 {
                     continue;
                 }
 
-                coinSpawner?.Spawn(batch.symbol, batch.countsPerCoin);
+                coinSpawner?.SetLogoSource(batch.symbol, balance.logoUrl, balance.logoHash);
+                coinSpawner?.Spawn(batch.symbol, i, batch.tier, batch.countsPerCoin);
+
+                if (!_firstCoinReported)
+                {
+                    _firstCoinReported = true;
+                    Bridge.PostTiming("firstCoin");
+                }
             }
         }
 
+        private static bool SameCoins(WalletMessage.Balance a, WalletMessage.Balance b)
+        {
+            return a.amount == b.amount &&
+                   string.Equals(a.symbol, b.symbol, StringComparison.OrdinalIgnoreCase) &&
+                   a.logoUrl == b.logoUrl &&
+                   a.logoHash == b.logoHash;
+        }
+
         private void HandleResetRequested()
         {
             coinSpawner?.ClearCoins();
+            _spawnedBalances = Array.Empty<WalletMessage.Balance>();
             ResetDoor();
         }
 
@@ -10,6 +10,7 @@ namespace Wallet
             public string symbol;
             public int coinCount;
             public int divisor;
+            public int tier;
             public List<int> countsPerCoin;
         }
 
@@ -32,6 +33,7 @@ namespace Wallet
                     symbol = safeSymbol,
                     coinCount = 0,
                     divisor = divisor,
+                    tier = ComputeTier(divisor),
                     countsPerCoin = new List<int>(),
                 };
             }
@@ -60,6 +62,7 @@ namespace Wallet
                 symbol = safeSymbol,
                 coinCount = coinCount,
                 divisor = divisor,
+                tier = ComputeTier(divisor),
                 countsPerCoin = counts,
             };
         }
@@ -82,5 +85,20 @@ namespace Wallet
 
             return (int)Math.Max(1d, divisorDouble);
         }
+
+        /// <summary>
+        /// Power of ten of the divisor, i.e. how many units a full coin of this batch stands for.
+        /// </summary>
+        public static int ComputeTier(int divisor)
+        {
+            var tier = 0;
+            while (divisor >= 10)
+            {
+                divisor /= 10;
+                tier++;
+            }
+
+            return tier;
+        }
     }
 }
@@ -13,6 +13,11 @@ namespace Wallet
         {
             public string symbol = string.Empty;
             public double amount;
+
+            // Optional; used for tokens without a bundled logo. logoHash, when set, keys the
+            // on-device logo cache instead of the URL.
+            public string logoUrl = string.Empty;
+            public string logoHash = string.Empty;
         }
     }
 }
@@ -0,0 +1,51 @@
+#nullable enable
+
+using System.Globalization;
+using System.Text;
+using Messaging;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+
+namespace Vault.Tests.EditMode
+{
+    /// <summary>
+    /// Parse cost of <see cref="Bridge.SetWalletJSON"/> for small, large and whale-sized wallets.
+    /// </summary>
+    public class BridgeParsePerformanceTests
+    {
+        [Test, Performance]
+        public void SetWalletJSON([Values(10, 1_000, 10_000)] int balanceCount)
+        {
+            var json = BuildPayload(balanceCount);
+
+            Measure.Method(() => Bridge.SetWalletJSON(json))
+                .WarmupCount(3)
+                .MeasurementCount(15)
+                .GC()
+                .Run();
+
+            Assert.That(Bridge.LatestWalletMessage?.balances.Length, Is.EqualTo(balanceCount));
+        }
+
+        internal static string BuildPayload(int balanceCount)
+        {
+            var builder = new StringBuilder("{\"type\":\"setWallet\",\"balances\":[");
+            for (var i = 0; i < balanceCount; i++)
+            {
+                if (i > 0)
+                {
+                    builder.Append(',');
+                }
+
+                var amount = (i % 7 + 1) * System.Math.Pow(10, i % 9) + i * 0.125;
+                builder.Append("{\"symbol\":\"TKN")
+                    .Append(i.ToString(CultureInfo.InvariantCulture))
+                    .Append("\",\"amount\":")
+                    .Append(amount.ToString("R", CultureInfo.InvariantCulture))
+                    .Append('}');
+            }
+
+            return builder.Append("]}").ToString();
+        }
+    }
+}
@@ -0,0 +1,26 @@
+#nullable enable
+
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using Wallet;
+
+namespace Vault.Tests.EditMode
+{
+    /// <summary>
+    /// Cost of turning one balance into a coin batch, across the divisor tiers of the aggregation rule.
+    /// </summary>
+    public class CoinAggregatorPerformanceTests
+    {
+        [Test, Performance]
+        public void Compute(
+            [Values(3d, 250d, 1_234d, 105_000d, 12_345_678.9d, 1e15d)] double amount)
+        {
+            Measure.Method(() => CoinAggregator.Compute("ETH", amount))
+                .WarmupCount(10)
+                .MeasurementCount(20)
+                .IterationsPerMeasurement(1_000)
+                .GC()
+                .Run();
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#nullable enable
+
+using System.Collections;
+using Interaction;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+namespace Vault.Tests.PlayMode
+{
+    /// <summary>
+    /// Per-frame cost of <see cref="CoinSelectable"/> highlight updates, idle and with every coin hovered.
+    /// </summary>
+    public class CoinSelectablePerformanceTests
+    {
+        [UnityTest, Performance]
+        public IEnumerator HighlightUpdate([Values(100, 1_000, 5_000)] int coinCount, [Values(false, true)] bool hovered)
+        {
+            yield return CoinSpawnerPerformanceTests.LoadVaultScene();
+            var spawner = Object.FindAnyObjectByType<CoinSpawner>();
+            Assert.That(spawner, Is.Not.Null, "Vault scene has no CoinSpawner.");
+
+            spawner!.Spawn("BTC", 0, 0, CoinSpawnerPerformanceTests.Counts(coinCount));
+            yield return null;
+
+            if (hovered)
+            {
+                foreach (var selectable in Object.FindObjectsByType<CoinSelectable>(FindObjectsSortMode.None))
+                {
+                    selectable.SetHover(true);
+                }
+            }
+
+            // CoinSelectable.Update dominates BehaviourUpdate once thousands of coins are live.
+            yield return Measure.Frames()
+                .ProfilerMarkers("BehaviourUpdate")
+                .WarmupCount(10)
+                .MeasurementCount(60)
+                .Run();
+
+            spawner.ClearCoins();
+        }
+    }
+}
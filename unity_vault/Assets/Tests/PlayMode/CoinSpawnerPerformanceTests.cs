@@ -0,0 +1,81 @@
+#nullable enable
+
+using System.Collections;
+using System.Collections.Generic;
+using NUnit.Framework;
+using Unity.PerformanceTesting;
+using UnityEngine;
+using UnityEngine.SceneManagement;
+using UnityEngine.TestTools;
+
+namespace Vault.Tests.PlayMode
+{
+    /// <summary>
+    /// Spawn, clear and per-frame cost of the vault scene's <see cref="CoinSpawner"/> at increasing coin counts.
+    /// Uses the spawner configured in the vault scene so prefab, colliders and labels match production.
+    /// </summary>
+    public class CoinSpawnerPerformanceTests
+    {
+        internal const string VaultScene = "UnityEngine";
+
+        internal static IEnumerator LoadVaultScene()
+        {
+            yield return SceneManager.LoadSceneAsync(VaultScene, LoadSceneMode.Single);
+        }
+
+        internal static List<int> Counts(int coinCount)
+        {
+            var counts = new List<int>(coinCount);
+            for (var i = 0; i < coinCount; i++)
+            {
+                counts.Add(1);
+            }
+
+            return counts;
+        }
+
+        [UnityTest, Performance]
+        public IEnumerator SpawnAndClear([Values(100, 1_000, 5_000)] int coinCount)
+        {
+            yield return LoadVaultScene();
+            var spawner = Object.FindAnyObjectByType<CoinSpawner>();
+            Assert.That(spawner, Is.Not.Null, "Vault scene has no CoinSpawner.");
+
+            var counts = Counts(coinCount);
+            for (var run = 0; run < 5; run++)
+            {
+                using (Measure.Scope("CoinSpawner.Spawn"))
+                {
+                    spawner!.Spawn("BTC", 0, 0, counts);
+                }
+
+                yield return null;
+
+                using (Measure.Scope("CoinSpawner.ClearCoins"))
+                {
+                    spawner!.ClearCoins();
+                }
+
+                yield return null;
+            }
+        }
+
+        [UnityTest, Performance]
+        public IEnumerator FrameCostWithCoins([Values(100, 1_000, 5_000)] int coinCount)
+        {
+            yield return LoadVaultScene();
+            var spawner = Object.FindAnyObjectByType<CoinSpawner>();
+            Assert.That(spawner, Is.Not.Null, "Vault scene has no CoinSpawner.");
+
+            spawner!.Spawn("BTC", 0, 0, Counts(coinCount));
+
+            yield return Measure.Frames()
+                .ProfilerMarkers("FixedUpdate.PhysicsFixedUpdate", "BehaviourUpdate")
+                .WarmupCount(10)
+                .MeasurementCount(60)
+                .Run();
+
+            spawner.ClearCoins();
+        }
+    }
+}
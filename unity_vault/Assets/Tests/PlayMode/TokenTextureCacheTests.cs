@@ -0,0 +1,241 @@
+#nullable enable
+
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.IO;
+using System.Net;
+using System.Net.Sockets;
+using System.Threading;
+using NUnit.Framework;
+using UnityEngine;
+using UnityEngine.TestTools;
+
+namespace Vault.Tests.PlayMode
+{
+    /// <summary>
+    /// Runtime logo loading in <see cref="TokenTextureCache"/>, served by a local HTTP stand-in for
+    /// token logo hosts.
+    /// </summary>
+    [UnityPlatform(exclude = new[] { RuntimePlatform.WebGLPlayer })]
+    public class TokenTextureCacheTests
+    {
+        private LogoServer _server = default!;
+        private string _diskCache = string.Empty;
+
+        [SetUp]
+        public void SetUp()
+        {
+            _server = new LogoServer();
+            _diskCache = Path.Combine(Application.temporaryCachePath, "TokenLogos-" + Guid.NewGuid().ToString("N"));
+        }
+
+        [TearDown]
+        public void TearDown()
+        {
+            _server.Dispose();
+            if (Directory.Exists(_diskCache))
+            {
+                Directory.Delete(_diskCache, true);
+            }
+        }
+
+        [UnityTest]
+        public IEnumerator LoadsRemoteLogo()
+        {
+            using var cache = new TokenTextureCache("Tokens", 8, 4, _diskCache);
+            var loaded = new List<string>();
+            cache.Loaded += (symbol, _) => loaded.Add(symbol);
+
+            cache.SetRemoteSource("T0001", _server.UrlFor("T0001"), null);
+            cache.Request("T0001");
+            yield return WaitFor(() => loaded.Count == 1);
+
+            Assert.IsTrue(cache.TryGet("T0001", out var texture));
+            Assert.AreEqual(LogoServer.Size, texture.width);
+        }
+
+        [UnityTest]
+        public IEnumerator PersistentCacheAvoidsRefetch()
+        {
+            var loaded = 0;
+            using (var first = new TokenTextureCache("Tokens", 8, 4, _diskCache))
+            {
+                first.Loaded += (_, _) => loaded++;
+                first.SetRemoteSource("T0001", _server.UrlFor("T0001"), "t0001-v1");
+                first.Request("T0001");
+                yield return WaitFor(() => loaded == 1);
+            }
+
+            using var second = new TokenTextureCache("Tokens", 8, 4, _diskCache);
+            second.Loaded += (_, _) => loaded++;
+            second.SetRemoteSource("T0001", _server.UrlFor("T0001"), "t0001-v1");
+            second.Request("T0001");
+            yield return WaitFor(() => loaded == 2);
+
+            Assert.AreEqual(1, _server.Hits);
+        }
+
+        [UnityTest]
+        public IEnumerator BoundsConcurrentLoads()
+        {
+            _server.Delay = TimeSpan.FromMilliseconds(50);
+            using var cache = new TokenTextureCache("Tokens", 16, 2, _diskCache);
+            var loaded = 0;
+            cache.Loaded += (_, _) => loaded++;
+
+            for (var i = 0; i < 8; i++)
+            {
+                var symbol = $"T{i:0000}";
+                cache.SetRemoteSource(symbol, _server.UrlFor(symbol), null);
+                cache.Request(symbol);
+            }
+
+            yield return WaitFor(() => loaded == 8);
+            Assert.LessOrEqual(_server.MaxConcurrent, 2);
+        }
+
+        [UnityTest]
+        public IEnumerator EvictsLeastRecentlyUsed()
+        {
+            using var cache = new TokenTextureCache("Tokens", 2, 4, _diskCache);
+            var loaded = 0;
+            var evicted = new List<string>();
+            cache.Loaded += (_, _) => loaded++;
+            cache.Evicted += evicted.Add;
+
+            foreach (var symbol in new[] { "T0001", "T0002", "T0003" })
+            {
+                cache.SetRemoteSource(symbol, _server.UrlFor(symbol), null);
+            }
+
+            cache.Request("T0001");
+            yield return WaitFor(() => loaded == 1);
+            cache.Request("T0002");
+            yield return WaitFor(() => loaded == 2);
+            cache.TryGet("T0001", out _);
+            cache.Request("T0003");
+            yield return WaitFor(() => loaded == 3);
+
+            CollectionAssert.AreEqual(new[] { "T0002" }, evicted);
+            Assert.AreEqual(2, cache.ResidentCount);
+        }
+
+        [UnityTest]
+        public IEnumerator MissingLogoIsNotRetried()
+        {
+            using var cache = new TokenTextureCache("Tokens", 8, 4, _diskCache);
+            cache.SetRemoteSource("MISSING", _server.UrlFor("MISSING"), null);
+
+            LogAssert.Expect(LogType.Warning, new System.Text.RegularExpressions.Regex("Failed to load MISSING"));
+            cache.Request("MISSING");
+            yield return WaitFor(() => cache.PendingCount == 0);
+
+            cache.Request("MISSING");
+            Assert.AreEqual(0, cache.PendingCount);
+            Assert.AreEqual(1, _server.Hits);
+            Assert.IsFalse(cache.TryGet("MISSING", out _));
+        }
+
+        private static IEnumerator WaitFor(Func<bool> condition, float timeoutSeconds = 5f)
+        {
+            var deadline = Time.realtimeSinceStartup + timeoutSeconds;
+            while (!condition())
+            {
+                if (Time.realtimeSinceStartup > deadline)
+                {
+                    Assert.Fail("Timed out waiting for the logo cache.");
+                }
+
+                yield return null;
+            }
+        }
+
+        /// <summary>
+        /// Serves a generated PNG for every <c>/&lt;SYMBOL&gt;.png</c> except <c>MISSING</c>, counting requests.
+        /// </summary>
+        private sealed class LogoServer : IDisposable
+        {
+            public const int Size = 8;
+
+            private readonly HttpListener _listener = new();
+            private readonly byte[] _png;
+            private readonly string _prefix;
+            private int _hits;
+            private int _inFlight;
+            private int _maxConcurrent;
+
+            public LogoServer()
+            {
+                var texture = new Texture2D(Size, Size, TextureFormat.RGBA32, false);
+                _png = texture.EncodeToPNG();
+                UnityEngine.Object.Destroy(texture);
+
+                _prefix = $"http://127.0.0.1:{FreePort()}/";
+                _listener.Prefixes.Add(_prefix);
+                _listener.Start();
+                new Thread(Listen) { IsBackground = true }.Start();
+            }
+
+            public TimeSpan Delay { get; set; } = TimeSpan.Zero;
+            public int Hits => Volatile.Read(ref _hits);
+            public int MaxConcurrent => Volatile.Read(ref _maxConcurrent);
+
+            public string UrlFor(string symbol) => $"{_prefix}{symbol}.png";
+
+            public void Dispose() => _listener.Close();
+
+            private static int FreePort()
+            {
+                var probe = new TcpListener(IPAddress.Loopback, 0);
+                probe.Start();
+                var port = ((IPEndPoint)probe.LocalEndpoint).Port;
+                probe.Stop();
+                return port;
+            }
+
+            private void Listen()
+            {
+                try
+                {
+                    while (_listener.IsListening)
+                    {
+                        var context = _listener.GetContext();
+                        ThreadPool.QueueUserWorkItem(_ => Serve(context));
+                    }
+                }
+                catch (Exception) when (!_listener.IsListening)
+                {
+                    // Closed by Dispose.
+                }
+            }
+
+            private void Serve(HttpListenerContext context)
+            {
+                Interlocked.Increment(ref _hits);
+                var inFlight = Interlocked.Increment(ref _inFlight);
+                int max;
+                while (inFlight > (max = Volatile.Read(ref _maxConcurrent)) &&
+                       Interlocked.CompareExchange(ref _maxConcurrent, inFlight, max) != max)
+                {
+                }
+
+                Thread.Sleep(Delay);
+                Interlocked.Decrement(ref _inFlight);
+                using (var response = context.Response)
+                {
+                    if (context.Request.Url.AbsolutePath.StartsWith("/MISSING", StringComparison.Ordinal))
+                    {
+                        response.StatusCode = 404;
+                    }
+                    else
+                    {
+                        response.ContentType = "image/png";
+                        response.ContentLength64 = _png.Length;
+                        response.OutputStream.Write(_png, 0, _png.Length);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+// Records the bridge traffic of the vault player so a session can be replayed
+// into the player later (see BridgeReplay.cs and tool/vault_wallet_gen.mjs).
+//
+// Recording starts with the page when the player URL carries `record=1` (the
+// Flutter host forwards `?vaultRecord=1`), or on demand via
+// UnityVaultRecorder.start(). UnityVaultRecorder.save() stops and downloads the
+// session as {version, source, events: [{at, type, ...}]}, with `at` in ms since
+// the start.
+(function () {
+  'use strict';
+
+  const round = (ms) => Math.round(ms * 100) / 100;
+
+  const recorder = {
+    recording: false,
+    startedAt: 0,
+    events: [],
+    selectionCursor: 0,
+    start() {
+      this.recording = true;
+      this.startedAt = performance.now();
+      this.events = [];
+      this.selectionCursor = window.UnityVault?.selectionRing?.sequence ?? 0;
+    },
+    stop() {
+      this.recording = false;
+      return { version: 1, source: `recorded:${location.href}`, events: this.events };
+    },
+    // type is one of setWallet ({payload}), reset, pause ({paused}) or selection.
+    record(type, fields) {
+      if (!this.recording) {
+        return;
+      }
+      this.events.push({ at: round(performance.now() - this.startedAt), type, ...fields });
+    },
+    // Called from WebGLBridge.jslib with the selection ring; keeps its own cursor so
+    // the Flutter panel's reader is unaffected. See SelectionEventBuffer.cs for the layout.
+    recordSelections(ring) {
+      if (!this.recording) {
+        return;
+      }
+      let cursor = Math.max(this.selectionCursor, ring.sequence - ring.capacity);
+      this.selectionCursor = ring.sequence;
+      for (; cursor < ring.sequence; cursor += 1) {
+        const slot = ring.base + (cursor % ring.capacity) * ring.stride;
+        this.record('selection', {
+          kind: ring.view[slot],
+          symbolId: ring.view[slot + 1],
+          countPerCoin: ring.view[slot + 2],
+          tier: ring.view[slot + 3],
+          coinIndex: ring.view[slot + 4],
+        });
+      }
+    },
+    save(name = `vault-recording-${Date.now()}.json`) {
+      const blob = new Blob([JSON.stringify(this.stop())], { type: 'application/json' });
+      const link = document.createElement('a');
+      const url = URL.createObjectURL(blob);
+      link.href = url;
+      link.download = name;
+      link.click();
+      // Revoking in the same task can cancel the download in some browsers.
+      setTimeout(() => URL.revokeObjectURL(url), 0);
+    },
+  };
+
+  if (new URLSearchParams(location.search).get('record') === '1') {
+    recorder.start();
+  }
+
+  window.UnityVaultRecorder = recorder;
+})();
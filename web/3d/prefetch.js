@@ -0,0 +1,160 @@
+// Warms the Unity WebGL build from the Flutter document while the landing route
+// is visible, and records the cold-start timeline up to the first spawned coin.
+//
+// Downloads go through the regular HTTP cache, so the later createUnityInstance
+// inside /3d/index.html picks them up without a second network round-trip. The
+// wasm module is compiled here and handed to the player via instantiateWasm.
+(function () {
+  'use strict';
+
+  const scopeUrl = new URL('./', document.currentScript.src).href;
+  const buildUrl = new URL('Build/Build', scopeUrl).href;
+  const artifacts = {
+    loaderUrl: `${buildUrl}.loader.js`,
+    frameworkUrl: `${buildUrl}.framework.js.unityweb`,
+    dataUrl: `${buildUrl}.data.unityweb`,
+    codeUrl: `${buildUrl}.wasm.unityweb`,
+  };
+
+  const timeline = {
+    marks: {},
+    mark(name) {
+      if (name in this.marks) {
+        return;
+      }
+      this.marks[name] = performance.now();
+      try {
+        performance.mark(`vault:${name}`);
+      } catch (_) {
+        // Marks are diagnostic only.
+      }
+      if (name === 'firstCoin') {
+        this.report();
+      }
+    },
+    report() {
+      const rows = Object.entries(this.marks)
+        .sort((a, b) => a[1] - b[1])
+        .map(([name, at]) => `${name}=${Math.round(at)}ms`);
+      try {
+        performance.measure('vault:time-to-first-coin', undefined, 'vault:firstCoin');
+      } catch (_) {
+        // Older browsers do not accept an undefined start mark.
+      }
+      console.info(`[VaultTiming] ${rows.join(' ')}`);
+    },
+    // Bridge latency samples in ms, keyed by message and transport (e.g.
+    // "walletPush:port"); a summary is logged every 20 samples.
+    latency: {},
+    sample(name, ms) {
+      const entry = (this.latency[name] ??= { count: 0, samples: [] });
+      entry.count += 1;
+      entry.samples.push(ms);
+      if (entry.samples.length > 200) {
+        entry.samples.shift();
+      }
+      if (entry.count % 20 !== 0) {
+        return;
+      }
+      const sorted = [...entry.samples].sort((a, b) => a - b);
+      const at = (q) => sorted[Math.min(sorted.length - 1, Math.floor(q * sorted.length))].toFixed(2);
+      console.info(`[VaultLatency] ${name} n=${sorted.length} p50=${at(0.5)}ms p95=${at(0.95)}ms`);
+    },
+  };
+
+  const lowPriorityFetch = (url) =>
+    fetch(url, { priority: 'low', credentials: 'same-origin' });
+
+  const isGzip = (bytes) => {
+    const view = new Uint8Array(bytes, 0, Math.min(2, bytes.byteLength));
+    return view.length === 2 && view[0] === 0x1f && view[1] === 0x8b;
+  };
+
+  // Mirrors the cache layout of vault_sw.js: artifacts stored under their
+  // content hash from build-manifest.json.
+  const cachedArtifact = async (name) => {
+    if (typeof caches === 'undefined') {
+      return null;
+    }
+    const cache = await caches.open('vault-build');
+    const manifestResponse = await cache.match(new URL('build-manifest.json', scopeUrl).href);
+    const entry = manifestResponse ? (await manifestResponse.json()).files?.[name] : null;
+    return entry ? cache.match(new URL(`Build/__content/${entry.hash}`, scopeUrl).href) : null;
+  };
+
+  const hasActiveServiceWorker = async () => {
+    try {
+      const registration = await navigator.serviceWorker?.getRegistration(scopeUrl);
+      return !!registration?.active;
+    } catch (_) {
+      return false;
+    }
+  };
+
+  const compileWasm = async () => {
+    const cached = await cachedArtifact(artifacts.codeUrl.split('/').pop()).catch(() => null);
+    // Still-encoded artifacts (see vault_sw.js) go through the paths below.
+    if (cached && !cached.headers.has('Content-Encoding')) {
+      return WebAssembly.compileStreaming(cached);
+    }
+
+    if (typeof WebAssembly.compileStreaming === 'function') {
+      try {
+        return await WebAssembly.compileStreaming(lowPriorityFetch(artifacts.codeUrl));
+      } catch (_) {
+        // Served without application/wasm or without Content-Encoding; the
+        // buffered path below reuses the now-cached response.
+      }
+    }
+
+    let bytes = await (await lowPriorityFetch(artifacts.codeUrl)).arrayBuffer();
+    if (isGzip(bytes) && typeof DecompressionStream === 'function') {
+      const stream = new Blob([bytes]).stream().pipeThrough(new DecompressionStream('gzip'));
+      bytes = await new Response(stream).arrayBuffer();
+    }
+    return WebAssembly.compile(bytes);
+  };
+
+  const warm = (url) =>
+    lowPriorityFetch(url)
+      .then((response) => response.arrayBuffer())
+      .catch((error) => console.warn(`[VaultPrefetch] ${url} failed`, error));
+
+  const prefetch = {
+    artifacts,
+    wasmModule: null,
+    started: false,
+    start() {
+      if (this.started || typeof WebAssembly !== 'object') {
+        return;
+      }
+      this.started = true;
+      timeline.mark('prefetchStart');
+
+      // On repeat visits the service worker already holds the build, so only
+      // the wasm compile is worth doing ahead of time.
+      hasActiveServiceWorker().then((cachedBuild) => {
+        if (cachedBuild) {
+          return;
+        }
+        warm(artifacts.loaderUrl).then(() => timeline.mark('loaderFetched'));
+        warm(artifacts.frameworkUrl).then(() => timeline.mark('frameworkFetched'));
+        warm(artifacts.dataUrl).then(() => timeline.mark('dataFetched'));
+      });
+
+      // Resolves to null on failure so the player falls back to its own path.
+      this.wasmModule = compileWasm()
+        .then((module) => {
+          timeline.mark('wasmCompiled');
+          return module;
+        })
+        .catch((error) => {
+          console.warn('[VaultPrefetch] wasm precompile failed', error);
+          return null;
+        });
+    },
+  };
+
+  window.UnityVaultTimeline = timeline;
+  window.UnityVaultPrefetch = prefetch;
+})();
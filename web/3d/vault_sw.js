@@ -0,0 +1,171 @@
+// Cache-first store for the Unity WebGL build served from /3d/Build/.
+//
+// Artifacts are stored in Cache Storage under their content hash from
+// build-manifest.json (see tool/unity_build_manifest.mjs), so a repeat visit
+// never touches the network for the build. The manifest itself is revalidated
+// in the background on each navigation; entries whose hash drops out of the
+// manifest are pruned one build generation later.
+//
+// A synthetic Response cannot ask the browser to decode Content-Encoding, so
+// gzip artifacts that arrive still compressed are decoded here and stored with
+// their real Content-Type (application/wasm for the code file) and without a
+// Content-Encoding header. That keeps WebAssembly.instantiateStreaming on the
+// fast path and lets the Unity loader skip its JavaScript decompressor.
+// Bodies the worker cannot decode (brotli, or gzip without
+// DecompressionStream) are stored as they came, keeping their Content-Encoding
+// and an opaque Content-Type so nothing mistakes them for decoded wasm.
+'use strict';
+
+const CACHE_NAME = 'vault-build';
+const scopeUrl = new URL('./', self.location).href;
+const buildUrl = new URL('Build/', scopeUrl).href;
+const manifestUrl = new URL('build-manifest.json', scopeUrl).href;
+const contentUrl = (hash) => new URL(`Build/__content/${hash}`, scopeUrl).href;
+
+let manifestPromise = null;
+let previousManifest = null;
+const clientManifests = new Map();
+
+const readCachedManifest = async () => {
+  const cache = await caches.open(CACHE_NAME);
+  const response = await cache.match(manifestUrl);
+  return response ? response.json() : null;
+};
+
+const prune = async (cache, manifests) => {
+  const live = new Set();
+  for (const manifest of manifests) {
+    for (const entry of Object.values(manifest?.files ?? {})) {
+      live.add(contentUrl(entry.hash));
+    }
+  }
+
+  const prefix = contentUrl('');
+  for (const request of await cache.keys()) {
+    if (request.url.startsWith(prefix) && !live.has(request.url)) {
+      await cache.delete(request);
+    }
+  }
+};
+
+const forgetClosedClients = async () => {
+  for (const id of clientManifests.keys()) {
+    if (!(await self.clients.get(id))) {
+      clientManifests.delete(id);
+    }
+  }
+};
+
+const refreshManifest = async () => {
+  await forgetClosedClients();
+  const response = await fetch(manifestUrl, { cache: 'no-cache' });
+  if (!response.ok) {
+    throw new Error(`manifest ${response.status}`);
+  }
+
+  const manifest = await response.clone().json();
+  const current = await currentManifest();
+  if (current?.version === manifest.version) {
+    return current;
+  }
+
+  const cache = await caches.open(CACHE_NAME);
+  await cache.put(manifestUrl, response);
+  await prune(cache, [manifest, current]);
+  previousManifest = current;
+  manifestPromise = Promise.resolve(manifest);
+  return manifest;
+};
+
+const currentManifest = () => {
+  if (!manifestPromise) {
+    manifestPromise = readCachedManifest().catch(() => null);
+  }
+  return manifestPromise;
+};
+
+const normalize = (response, entry) => {
+  // Same-origin responses expose Content-Encoding; when present the browser
+  // has already decoded the body for us.
+  const decodedByBrowser = response.headers.has('Content-Encoding');
+  let body = response.body;
+  let decoded = decodedByBrowser || entry.encoding === 'identity';
+  if (!decoded && entry.encoding === 'gzip' && typeof DecompressionStream === 'function') {
+    body = body.pipeThrough(new DecompressionStream('gzip'));
+    decoded = true;
+  }
+
+  const headers = {
+    'Content-Type': decoded ? entry.contentType : 'application/octet-stream',
+    'Content-Length': String(decoded ? entry.decodedSize : entry.size),
+    'Cache-Control': 'public, max-age=31536000, immutable',
+  };
+  if (!decoded) {
+    headers['Content-Encoding'] = entry.encoding;
+  }
+  return new Response(body, { status: 200, headers });
+};
+
+const store = async (cache, key, response) => {
+  const expected = Number(response.headers.get('Content-Length'));
+  const bytes = await response.arrayBuffer();
+  if (bytes.byteLength !== expected) {
+    // Truncated or from a different build than the manifest describes.
+    return;
+  }
+  await cache.put(key, new Response(bytes, { headers: response.headers }));
+};
+
+const serveArtifact = async (event) => {
+  const manifest = await (clientManifests.get(event.clientId) ?? currentManifest());
+  const name = decodeURIComponent(new URL(event.request.url).pathname.split('/').pop());
+  const entry = manifest?.files?.[name] ?? previousManifest?.files?.[name];
+  if (!entry) {
+    return fetch(event.request);
+  }
+
+  const cache = await caches.open(CACHE_NAME);
+  const key = contentUrl(entry.hash);
+  const cached = await cache.match(key);
+  if (cached) {
+    return cached;
+  }
+
+  const response = await fetch(event.request.url, { cache: 'no-cache' });
+  if (!response.ok) {
+    return response;
+  }
+
+  const normalized = normalize(response, entry);
+  event.waitUntil(store(cache, key, normalized.clone()).catch(() => {}));
+  return normalized;
+};
+
+self.addEventListener('install', (event) => {
+  event.waitUntil(refreshManifest().catch(() => null).then(() => self.skipWaiting()));
+});
+
+self.addEventListener('activate', (event) => {
+  event.waitUntil(self.clients.claim());
+});
+
+self.addEventListener('fetch', (event) => {
+  const request = event.request;
+  if (request.method !== 'GET') {
+    return;
+  }
+
+  if (request.mode === 'navigate') {
+    // Pin the manifest the page starts with so a deploy mid-load cannot mix
+    // artifacts from two builds, then revalidate for the next visit.
+    if (event.resultingClientId) {
+      clientManifests.set(event.resultingClientId, currentManifest());
+    }
+    event.waitUntil(refreshManifest().catch(() => null));
+    return;
+  }
+
+  if (request.url.startsWith(buildUrl)) {
+    event.respondWith(serveArtifact(event));
+  }
+});